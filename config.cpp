@@ -1,7 +1,9 @@
 #include "config.h"
 #include "water_coll_det.h"
+#include "water_splash_curve.h"
 #include <algorithm>
 #include <cctype>
+#include <chrono>
 #include <filesystem>
 #include <cstdarg>
 #include <windows.h>
@@ -10,11 +12,17 @@ namespace InteractiveWaterVR
 {
  int logging =0;
  int leftHandedMode =0;
+ bool cfgLogPluginRecords = false;
 
  // Movement detection configurable values (defaults match current code)
  float cfgMovingConfirmSeconds =1.0f;
  float cfgJitterThresholdAdjusted =0.02f;
  float cfgMovingThresholdAdjusted =0.08f;
+ // Motion filter defaults: smooth hard at rest, follow fast swings with little lag
+ float cfgFilterMinCutoff =1.5f;
+ float cfgFilterBeta =0.05f;
+ float cfgFilterDerivCutoff =12.0f;
+ bool cfgUseHiggsVelocity = true;
  // Ripple entry/exit Z thresholds (m/s)
  float cfgEntryDownZThreshold =0.5f;
  float cfgExitUpZThreshold =0.5f;
@@ -57,7 +65,15 @@ namespace InteractiveWaterVR
  float cfgSplashExitHardVol =0.5f;
  float cfgSplashExitVeryHardVol =0.5f;
 
+ std::string cfgSplashAmtCurve;
+ std::string cfgSplashVolCurve;
+ std::string cfgSplashExitAmtCurve;
+ std::string cfgSplashExitVolCurve;
+ bool cfgSplashCurveSmooth = true;
+ float cfgSplashSoundCrossfade =0.25f; // fade from b/1.25 to b*1.25 around each band boundary b
+
  float cfgSplashScale =1.0f; // global multiplier
+ float cfgFingertipRippleScale =0.5f; // fingertips touching before the wrist get a lighter ripple
 
  // Wake ripple amplitude default
  float cfgWakeAmt =0.009f; // default wake amplitude; can be overridden by INI WakeAmt
@@ -70,6 +86,53 @@ namespace InteractiveWaterVR
  float cfgWakeMaxMultiplier =2.0f; // max multiplier applied to cfgWakeAmt
  // Wake movement sound volume (0.0..1.0+)
  float cfgWakeMoveSoundVol =0.8f; // default volume for wake movement sound
+ bool cfgWeaponTipWake = true;
+ float cfgWakeTrailSpacing =10.0f;
+ int cfgWakeTrailMaxRipples =6;
+ // Ripple accumulator defaults
+ float cfgRippleMergeRadius =4.0f; // ~6 cm: consecutive 6 ms wake samples of a slow hand collapse into one
+ int cfgRippleMergeWindowMs =24; // about four monitoring ticks per wake ripple
+ int cfgRippleBudgetPerFrame =8;
+ // Nearby actor defaults
+ bool cfgActorWaterEnabled = true;
+ float cfgActorRange =3072.0f;
+ int cfgActorProbeBudget =24;
+ float cfgActorSplashScale =0.8f;
+ float cfgActorSplashVolume =0.6f;
+ // Thrown object defaults
+ bool cfgThrownObjectsEnabled = true;
+ float cfgThrownSplashScale =1.0f;
+ float cfgThrownSplashVolume =0.8f;
+ // Projectile defaults
+ bool cfgProjectilesEnabled = true;
+ float cfgProjectileRange =4096.0f;
+ int cfgProjectileScanCap =32;
+ float cfgProjectileSplashScale =0.6f;
+ float cfgProjectileSplashVolume =0.7f;
+ // Wading defaults
+ bool cfgWadingEnabled = true;
+ float cfgWadingMaxDepth =60.0f;
+ float cfgWadingSplashScale =0.7f;
+ float cfgWadingSplashVolume =0.7f;
+ bool cfgStrokeEnabled = true;
+ float cfgStrokeSpeedThreshold =40.0f;
+ float cfgStrokeSplashScale =0.6f;
+ float cfgStrokeSplashVolume =0.6f;
+ // Telemetry defaults
+ bool cfgTelemetryEnabled = true;
+ std::string cfgTelemetryFile;
+ // Trace defaults
+ bool cfgTraceEnabled = true;
+ std::string cfgTraceFile;
+ int cfgTraceSizeKB =1024;
+ // Performance defaults
+ bool cfgDispatcherEnabled = true;
+ float cfgFrameBudgetMs =11.1f;
+ int cfgPollIntervalMs =6;
+ int cfgTickSpinUs =500;
+ int cfgWorkerThreads =2;
+ int cfgWorkerPriority =0;
+ std::uint64_t cfgWorkerAffinityMask =0;
  float cfgTrackingLossSplashDelaySeconds =2.0f; // default2 seconds
 
  // Option: automatically unequip fire spells when submerged and flagged
@@ -140,10 +203,14 @@ namespace InteractiveWaterVR
  return p.parent_path().string() + "\\";
  }
 
- void loadConfig()
- {
- static bool s_warnedOnce = false;
+ // INI found by the first successful load; later loads open it directly instead of searching again
+ static std::string s_configPath;
+ static std::filesystem::file_time_type s_loadedWriteTime{};
+ // How often the monitor looks at the INI's write time
+ static constexpr auto kConfigCheckInterval = std::chrono::seconds(1);
 
+ static std::vector<std::string> GetConfigCandidates()
+ {
  std::vector<std::string> candidates;
  // Documents path (user config location)
  auto docs = GetDocumentsRuntimeDirectory();
@@ -158,9 +225,22 @@ namespace InteractiveWaterVR
  if (!modDir.empty()) candidates.push_back(modDir + "Interactive_Water_VR.ini");
  // also try plugin DLL dir with same filename in case
  if (!modDir.empty()) candidates.push_back(modDir + "\\Interactive_Water_VR.ini");
+ return candidates;
+ }
+
+ void loadConfig()
+ {
+ static bool s_warnedOnce = false;
 
  std::ifstream file;
  std::string openedPath;
+ if (!s_configPath.empty()) {
+ file.open(s_configPath);
+ if (file.is_open()) openedPath = s_configPath;
+ }
+ std::vector<std::string> candidates;
+ if (!file.is_open()) {
+ candidates = GetConfigCandidates();
  for (const auto& path : candidates) {
  file.open(path);
  if (file.is_open()) {
@@ -168,12 +248,15 @@ namespace InteractiveWaterVR
  break;
  }
  }
+ }
 
  if (!file.is_open()) {
  if (!s_warnedOnce) {
  IW_LOG_WARN("Config: failed to open any config file candidates");
  for (const auto& p : candidates) IW_LOG_WARN(" tried: %s", p.c_str());
  s_warnedOnce = true;
+ // Defaults still need their response tables
+ RebuildSplashCurves();
  }
  return;
  }
@@ -181,6 +264,16 @@ namespace InteractiveWaterVR
  // Successfully opened file; reset warned flag
  s_warnedOnce = false;
 
+ // Only parse (and rebake the splash curves) when the file changed
+ std::error_code writeTimeError;
+ const auto writeTime = std::filesystem::last_write_time(openedPath, writeTimeError);
+ if (!writeTimeError) {
+ if (openedPath == s_configPath && writeTime == s_loadedWriteTime) return;
+ s_loadedWriteTime = writeTime;
+ IW_LOG_INFO("Config: loading %s", openedPath.c_str());
+ }
+ s_configPath = openedPath;
+
  std::string line;
  std::string currentSection;
 
@@ -202,6 +295,8 @@ namespace InteractiveWaterVR
  try { logging = std::stoi(value); } catch (...) { }
  } else if (varName == "LeftHandedMode") {
  try { leftHandedMode = std::stoi(value); } catch (...) { }
+ } else if (varName == "LogPluginRecords") {
+ try { cfgLogPluginRecords = (std::stoi(value) !=0); } catch (...) { }
  } 
  } else if (currentSection == "Movement") {
  std::string varName;
@@ -210,6 +305,10 @@ namespace InteractiveWaterVR
  if (varName == "MovingConfirmSeconds") cfgMovingConfirmSeconds = std::stof(value);
  else if (varName == "JitterThreshold") cfgJitterThresholdAdjusted = std::stof(value);
  else if (varName == "MovingThreshold") cfgMovingThresholdAdjusted = std::stof(value);
+ else if (varName == "FilterMinCutoff") cfgFilterMinCutoff = std::stof(value);
+ else if (varName == "FilterBeta") cfgFilterBeta = std::stof(value);
+ else if (varName == "FilterDerivCutoff") cfgFilterDerivCutoff = std::stof(value);
+ else if (varName == "UseHiggsVelocity") cfgUseHiggsVelocity = (std::stoi(value) !=0);
  else if (varName == "EntryDownZThreshold") cfgEntryDownZThreshold = std::stof(value);
  else if (varName == "ExitUpZThreshold") cfgExitUpZThreshold = std::stof(value);
  else if (varName == "MinZDiffForEntryExit") cfgMinZDiffForEntryExit = std::stof(value);
@@ -229,12 +328,18 @@ namespace InteractiveWaterVR
  else if (varName == "HardAmt") cfgSplashHardAmt = std::stof(value);
  else if (varName == "VeryHardAmt") cfgSplashVeryHardAmt = std::stof(value);
  else if (varName == "Scale") cfgSplashScale = std::stof(value);
+ else if (varName == "FingertipRippleScale") cfgFingertipRippleScale = std::stof(value);
  // new volume keys
  else if (varName == "VeryLightVol") cfgSplashVeryLightVol = std::stof(value);
  else if (varName == "LightVol") cfgSplashLightVol = std::stof(value);
  else if (varName == "NormalVol") cfgSplashNormalVol = std::stof(value);
  else if (varName == "HardVol") cfgSplashHardVol = std::stof(value);
  else if (varName == "VeryHardVol") cfgSplashVeryHardVol = std::stof(value);
+ // response curves (override the bands above when set)
+ else if (varName == "AmtCurve") cfgSplashAmtCurve = value;
+ else if (varName == "VolCurve") cfgSplashVolCurve = value;
+ else if (varName == "CurveSmooth") cfgSplashCurveSmooth = (std::stoi(value) !=0);
+ else if (varName == "SoundCrossfade") cfgSplashSoundCrossfade = std::stof(value);
  // wake amount
  else if (varName == "WakeAmt") cfgWakeAmt = std::stof(value);
  } catch (...) {
@@ -258,6 +363,8 @@ namespace InteractiveWaterVR
  else if (varName == "NormalVol") cfgSplashExitNormalVol = std::stof(value);
  else if (varName == "HardVol") cfgSplashExitHardVol = std::stof(value);
  else if (varName == "VeryHardVol") cfgSplashExitVeryHardVol = std::stof(value);
+ else if (varName == "AmtCurve") cfgSplashExitAmtCurve = value;
+ else if (varName == "VolCurve") cfgSplashExitVolCurve = value;
  } catch (...) {
  }
  } else if (currentSection == "Wake") {
@@ -271,6 +378,99 @@ namespace InteractiveWaterVR
  else if (varName == "MaxMultiplier") cfgWakeMaxMultiplier = std::stof(value);
  else if (varName == "WaveAmt" || varName == "WaveSize" || varName == "Amt") cfgWakeAmt = std::stof(value);
  else if (varName == "WakeMoveSoundVol") cfgWakeMoveSoundVol = std::stof(value);
+ else if (varName == "WeaponTipWake") cfgWeaponTipWake = (std::stoi(value) !=0);
+ else if (varName == "TrailSpacing") cfgWakeTrailSpacing = std::stof(value);
+ else if (varName == "TrailMaxRipples") cfgWakeTrailMaxRipples = std::stoi(value);
+ } catch (...) {
+ }
+ } else if (currentSection == "Ripples") {
+ std::string varName;
+ auto value = GetConfigSettingsStringValue(line, varName);
+ try {
+ if (varName == "MergeRadius") cfgRippleMergeRadius = std::stof(value);
+ else if (varName == "MergeWindowMs") cfgRippleMergeWindowMs = std::stoi(value);
+ else if (varName == "BudgetPerFrame") cfgRippleBudgetPerFrame = std::stoi(value);
+ } catch (...) {
+ }
+ } else if (currentSection == "Actors") {
+ std::string varName;
+ auto value = GetConfigSettingsStringValue(line, varName);
+ try {
+ if (varName == "Enabled") cfgActorWaterEnabled = (std::stoi(value) !=0);
+ else if (varName == "Range") cfgActorRange = std::stof(value);
+ else if (varName == "ProbeBudget") cfgActorProbeBudget = std::stoi(value);
+ else if (varName == "SplashScale") cfgActorSplashScale = std::stof(value);
+ else if (varName == "SplashVolume") cfgActorSplashVolume = std::stof(value);
+ } catch (...) {
+ }
+ } else if (currentSection == "Thrown") {
+ std::string varName;
+ auto value = GetConfigSettingsStringValue(line, varName);
+ try {
+ if (varName == "Enabled") cfgThrownObjectsEnabled = (std::stoi(value) !=0);
+ else if (varName == "SplashScale") cfgThrownSplashScale = std::stof(value);
+ else if (varName == "SplashVolume") cfgThrownSplashVolume = std::stof(value);
+ } catch (...) {
+ }
+ } else if (currentSection == "Projectiles") {
+ std::string varName;
+ auto value = GetConfigSettingsStringValue(line, varName);
+ try {
+ if (varName == "Enabled") cfgProjectilesEnabled = (std::stoi(value) !=0);
+ else if (varName == "Range") cfgProjectileRange = std::stof(value);
+ else if (varName == "ScanCap") cfgProjectileScanCap = std::stoi(value);
+ else if (varName == "SplashScale") cfgProjectileSplashScale = std::stof(value);
+ else if (varName == "SplashVolume") cfgProjectileSplashVolume = std::stof(value);
+ } catch (...) {
+ }
+ } else if (currentSection == "Wading") {
+ std::string varName;
+ auto value = GetConfigSettingsStringValue(line, varName);
+ try {
+ if (varName == "Enabled") cfgWadingEnabled = (std::stoi(value) !=0);
+ else if (varName == "MaxDepth") cfgWadingMaxDepth = std::stof(value);
+ else if (varName == "SplashScale") cfgWadingSplashScale = std::stof(value);
+ else if (varName == "SplashVolume") cfgWadingSplashVolume = std::stof(value);
+ } catch (...) {
+ }
+ } else if (currentSection == "Swim") {
+ std::string varName;
+ auto value = GetConfigSettingsStringValue(line, varName);
+ try {
+ if (varName == "StrokeEnabled") cfgStrokeEnabled = (std::stoi(value) !=0);
+ else if (varName == "StrokeSpeedThreshold") cfgStrokeSpeedThreshold = std::stof(value);
+ else if (varName == "StrokeSplashScale") cfgStrokeSplashScale = std::stof(value);
+ else if (varName == "StrokeSplashVolume") cfgStrokeSplashVolume = std::stof(value);
+ } catch (...) {
+ }
+ } else if (currentSection == "Telemetry") {
+ std::string varName;
+ auto value = GetConfigSettingsStringValue(line, varName);
+ try {
+ if (varName == "Enabled") cfgTelemetryEnabled = (std::stoi(value) !=0);
+ else if (varName == "File") cfgTelemetryFile = value;
+ } catch (...) {
+ }
+ } else if (currentSection == "Trace") {
+ std::string varName;
+ auto value = GetConfigSettingsStringValue(line, varName);
+ try {
+ if (varName == "Enabled") cfgTraceEnabled = (std::stoi(value) !=0);
+ else if (varName == "File") cfgTraceFile = value;
+ else if (varName == "SizeKB") cfgTraceSizeKB = std::stoi(value);
+ } catch (...) {
+ }
+ } else if (currentSection == "Performance") {
+ std::string varName;
+ auto value = GetConfigSettingsStringValue(line, varName);
+ try {
+ if (varName == "DispatcherEnabled") cfgDispatcherEnabled = (std::stoi(value) !=0);
+ else if (varName == "FrameBudgetMs") cfgFrameBudgetMs = std::stof(value);
+ else if (varName == "PollIntervalMs") cfgPollIntervalMs = std::stoi(value);
+ else if (varName == "TickSpinUs") cfgTickSpinUs = std::stoi(value);
+ else if (varName == "WorkerThreads") cfgWorkerThreads = std::stoi(value);
+ else if (varName == "WorkerPriority") cfgWorkerPriority = std::stoi(value);
+ else if (varName == "WorkerAffinityMask") cfgWorkerAffinityMask = std::stoull(value, nullptr, 0);
  } catch (...) {
  }
  } else if (currentSection == "Loss") {
@@ -302,6 +502,41 @@ namespace InteractiveWaterVR
  IW_LOG_INFO("Config: WakeAmt %f exceeds max %f - clamping to max", cfgWakeAmt, kMaxWakeAmtClamp);
  cfgWakeAmt = kMaxWakeAmtClamp;
  }
+ // Upper bound keeps the trail spacing clamp below (MergeRadius + 1 .. 200) a valid range
+ cfgRippleMergeRadius = std::clamp(cfgRippleMergeRadius, 0.0f, 100.0f);
+ cfgRippleMergeWindowMs = std::clamp(cfgRippleMergeWindowMs, 0, 500);
+ cfgRippleBudgetPerFrame = std::clamp(cfgRippleBudgetPerFrame, 1, 64);
+ cfgActorProbeBudget = std::clamp(cfgActorProbeBudget, 1, 256);
+ cfgProjectileScanCap = std::clamp(cfgProjectileScanCap, 1, 64);
+ cfgFrameBudgetMs = std::clamp(cfgFrameBudgetMs, 4.0f, 50.0f);
+ cfgPollIntervalMs = std::clamp(cfgPollIntervalMs, 2, 50);
+ cfgTickSpinUs = std::clamp(cfgTickSpinUs, 0, 2000);
+ cfgWorkerThreads = std::clamp(cfgWorkerThreads, 1, 4);
+ cfgWorkerPriority = std::clamp(cfgWorkerPriority, -2, 2);
+ cfgTraceSizeKB = std::clamp(cfgTraceSizeKB, 64, 65536);
+ // Closer than the merge radius, trail ripples would just merge back into one
+ cfgWakeTrailSpacing = std::clamp(cfgWakeTrailSpacing, cfgRippleMergeRadius + 1.0f, 200.0f);
+ cfgWakeTrailMaxRipples = std::clamp(cfgWakeTrailMaxRipples, 1, 16);
+ cfgSplashSoundCrossfade = std::clamp(cfgSplashSoundCrossfade, 0.0f, 1.0f);
+ cfgStrokeSpeedThreshold = std::clamp(cfgStrokeSpeedThreshold, 5.0f, 500.0f);
+
+ RebuildSplashCurves();
+ }
+
+ void ReloadConfigIfChanged()
+ {
+ static std::chrono::steady_clock::time_point s_lastCheck{};
+ const auto now = std::chrono::steady_clock::now();
+ if (now - s_lastCheck < kConfigCheckInterval) return;
+ s_lastCheck = now;
+
+ // One stat of the known file; the candidate search only runs again while no file was found
+ if (!s_configPath.empty()) {
+ std::error_code ec;
+ const auto writeTime = std::filesystem::last_write_time(s_configPath, ec);
+ if (!ec && writeTime == s_loadedWriteTime) return;
+ }
+ loadConfig();
  }
 
  void Log(int msgLogLevel, const char* fmt, ...)
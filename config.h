@@ -2,6 +2,7 @@
 
 #include <string>
 #include <fstream>
+#include <cstdint>
 #include <cstdarg>
 #include "helper.h"
 #include "water_coll_det.h"
@@ -11,11 +12,18 @@ namespace InteractiveWaterVR
  // Config values
  extern int logging; // log level threshold (0 = errors only)
  extern int leftHandedMode;
+ // Diagnostic: dump every SpellInteractionsVR.esp record to the log once data is loaded (off by default)
+ extern bool cfgLogPluginRecords;
 
  // Movement detection configurable values
  extern float cfgMovingConfirmSeconds;
  extern float cfgJitterThresholdAdjusted;
  extern float cfgMovingThresholdAdjusted;
+ // Controller motion filter (One-Euro): cutoff at rest (Hz), speed coefficient, velocity cutoff (Hz)
+ extern float cfgFilterMinCutoff;
+ extern float cfgFilterBeta;
+ extern float cfgFilterDerivCutoff;
+ extern bool cfgUseHiggsVelocity; // read hand velocity from HIGGS rigid bodies when available
 
  // Ripple entry/exit Z thresholds (m/s). Entry requires downward Z speed >= this to emit on entry.
  // Exit requires upward Z speed >= this to emit on exit.
@@ -62,7 +70,16 @@ namespace InteractiveWaterVR
  extern float cfgSplashExitHardVol;
  extern float cfgSplashExitVeryHardVol;
 
+ // Continuous response curves ("speed:value, ..." knots); empty = use the band keys above as a step curve
+ extern std::string cfgSplashAmtCurve;
+ extern std::string cfgSplashVolCurve;
+ extern std::string cfgSplashExitAmtCurve;
+ extern std::string cfgSplashExitVolCurve;
+ extern bool cfgSplashCurveSmooth; // monotone cubic between knots instead of straight lines
+ extern float cfgSplashSoundCrossfade; // relative width around each band boundary where both band sounds play (0 = hard switch)
+
  extern float cfgSplashScale; // global multiplier applied to final amount
+ extern float cfgFingertipRippleScale; // multiplier on the entry amount for fingertip-first contact ripples (0 = off)
 
  // Wake ripple amplitude (spawned every frame while submerged & moving)
  extern float cfgWakeAmt;
@@ -72,6 +89,54 @@ namespace InteractiveWaterVR
  extern float cfgWakeMinMultiplier; // minimum multiplier applied to base cfgWakeAmt
  extern float cfgWakeMaxMultiplier; // maximum multiplier applied to base cfgWakeAmt
  extern float cfgWakeMoveSoundVol; // volume for wake movement sound
+extern bool cfgWeaponTipWake; // held weapon tips leave a wake (requires HIGGS)
+extern float cfgWakeTrailSpacing; // distance between wake ripples laid along the hand's path
+extern int cfgWakeTrailMaxRipples; // wake ripples per emission per hand; spacing widens beyond this
+// Ripple accumulator ([Ripples] section)
+extern float cfgRippleMergeRadius; // ripples of the same source closer than this (game units) are merged
+extern int cfgRippleMergeWindowMs; // how long a wake ripple is held open for merging
+extern int cfgRippleBudgetPerFrame; // hard cap on AddRipple calls per frame across all sources
+// Nearby actors ([Actors] section)
+extern bool cfgActorWaterEnabled; // NPCs/creatures near the player make ripples and splashes
+extern float cfgActorRange; // tracking radius around the player (game units)
+extern int cfgActorProbeBudget; // node water probes per update across all actors
+extern float cfgActorSplashScale; // ripple amplitude multiplier for actors
+extern float cfgActorSplashVolume; // splash volume multiplier for actors
+// Thrown/dropped objects ([Thrown] section, requires HIGGS)
+extern bool cfgThrownObjectsEnabled;
+extern float cfgThrownSplashScale; // ripple amplitude multiplier on top of the weight scale
+extern float cfgThrownSplashVolume; // splash volume multiplier
+// Projectiles ([Projectiles] section)
+extern bool cfgProjectilesEnabled;
+extern float cfgProjectileRange; // only projectiles within this horizontal distance of the player are scanned
+extern int cfgProjectileScanCap; // hard cap on projectiles examined per frame
+extern float cfgProjectileSplashScale; // ripple amplitude multiplier
+extern float cfgProjectileSplashVolume; // splash volume multiplier
+// Wading ([Wading] section)
+extern bool cfgWadingEnabled; // foot probes while wading
+extern float cfgWadingMaxDepth; // water depth at the player's root above which feet are no longer probed
+extern float cfgWadingSplashScale; // footstep ripple amplitude multiplier
+extern float cfgWadingSplashVolume; // footstep splash volume multiplier
+// Swimming ([Swim] section)
+extern bool cfgStrokeEnabled; // recognize swim strokes; each stroke gets one splash and its wake instead of continuous wakes
+extern float cfgStrokeSpeedThreshold; // body-relative hand speed (units/s) that counts as a forward or backward arm motion
+extern float cfgStrokeSplashScale; // stroke release ripple amplitude multiplier
+extern float cfgStrokeSplashVolume; // stroke release splash volume multiplier
+// Telemetry ([Telemetry] section)
+extern bool cfgTelemetryEnabled; // publish live counters through a shared-memory block
+extern std::string cfgTelemetryFile; // back the block with this file instead of a named mapping (empty = named mapping)
+// Event trace ([Trace] section)
+extern bool cfgTraceEnabled; // record splashes, transitions, ripples, sounds and spell edges to a binary ring file
+extern std::string cfgTraceFile; // ring file path (empty = Interactive_Water_VR.trace next to the plugin log)
+extern int cfgTraceSizeKB; // ring file size; oldest events are overwritten once full
+// Performance ([Performance] section)
+extern bool cfgDispatcherEnabled; // defer/thin non-critical main-thread work when frames run over budget
+extern float cfgFrameBudgetMs; // target frame time (11.1 ms = 90 Hz headset)
+extern int cfgPollIntervalMs; // detection tick period (ms)
+extern int cfgTickSpinUs; // the last N us before each tick deadline are spun instead of slept (0 = sleep only)
+extern int cfgWorkerThreads; // worker threads running the monitor/spell/spawner jobs (1..4, read once at startup)
+extern int cfgWorkerPriority; // worker thread priority -2..2 (lowest..highest), 0 = unchanged
+extern std::uint64_t cfgWorkerAffinityMask; // worker thread affinity mask, 0 = any core
 
  // Tracking loss splash delay
  extern float cfgTrackingLossSplashDelaySeconds; // delay before splash when tracking is lost
@@ -88,6 +153,8 @@ namespace InteractiveWaterVR
 
  // Load configuration from Data\SKSE\Plugins\Interactive_Water_VR.ini
  void loadConfig();
+ // Monitor tick: at most once a second, reload the INI if its write time changed
+ void ReloadConfigIfChanged();
 
  // Simple logging helper (keeps compatibility with old LOG macros)
  void Log(int msgLogLevel, const char* fmt, ...);
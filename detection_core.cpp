@@ -0,0 +1,95 @@
+// detection_core.cpp - Per-hand water entry/exit and wake decisions
+
+#include "detection_core.h"
+#include <algorithm>
+#include <cmath>
+
+namespace InteractiveWaterVR {
+
+// ============================================================================
+// Decisions
+// ============================================================================
+
+HandTransition DetectTransition(bool inWater, bool wasInWater, bool haveVelocity, float velZ,
+                                const DetectionParams& params) {
+    HandTransition t;
+    if (inWater && !wasInWater) {
+        t.entered = true;
+        t.speed = haveVelocity ? std::max(0.0f, -velZ) : 0.0f;
+        t.splash = haveVelocity && t.speed >= params.entryMinDownSpeed && t.speed <= params.entryMaxDownSpeed;
+    } else if (!inWater && wasInWater) {
+        t.exited = true;
+        t.speed = haveVelocity ? std::max(0.0f, velZ) : 0.0f;
+        t.splash = haveVelocity && t.speed >= params.exitMinUpSpeed && t.speed <= params.exitMaxUpSpeed;
+    }
+    return t;
+}
+
+bool WakeActive(bool inWater, float speed, float depth, const DetectionParams& params) {
+    const float speedThreshold = std::max(0.01f, params.movingThreshold * 0.5f);
+    return inWater && speed > speedThreshold && depth >= params.minWakeDepth;
+}
+
+int WakeRippleCount(float pathLen, float spacing, int maxRipples, float& emitSpacing) {
+    emitSpacing = spacing;
+    if (spacing <= 0.0f || maxRipples <= 0) return 0;
+    int n = static_cast<int>(pathLen / spacing);
+    if (n <= 0) return 0;
+    if (n > maxRipples) {
+        n = maxRipples;
+        emitSpacing = pathLen / static_cast<float>(n);
+    }
+    return n;
+}
+
+// ============================================================================
+// Hand detector
+// ============================================================================
+
+void HandDetector::Reset() {
+    *this = HandDetector{};
+}
+
+const HandEvents& HandDetector::Update(const HandSample& sample, float dt, const DetectionParams& params) {
+    _events = HandEvents{};
+    if (!_havePrev) dt = 0.0f;
+
+    _motion = _filter.Update(sample.x, sample.y, sample.z, dt, params.filter);
+    const float speed = _motion.valid ? _motion.speed : 0.0f;
+    const float velZ = _motion.valid ? _motion.vel.z : 0.0f;
+    _movement.Update(_motion, dt, params.movingThreshold, params.movingConfirmSeconds, params.stationarySeconds);
+
+    const float depth = sample.inWater ? std::max(0.0f, sample.surfaceZ - sample.z) : 0.0f;
+    _events.transition = DetectTransition(sample.inWater, _wasInWater, _havePrev, velZ, params);
+
+    // Wake: the path grows by the filtered point's horizontal travel while the wake is active and
+    // restarts at the last ripple of each emission, like WakeTrail
+    _sinceWakeSeconds += dt;
+    if (WakeActive(sample.inWater, speed, depth, params)) {
+        const float px = _motion.valid ? _motion.pos.x : sample.x;
+        const float py = _motion.valid ? _motion.pos.y : sample.y;
+        if (_haveWakePoint) _wakePathLen += std::hypot(px - _wakeX, py - _wakeY);
+        _wakeX = px;
+        _wakeY = py;
+        _haveWakePoint = true;
+        if (params.wakeSpawnMs == 0 || _sinceWakeSeconds * 1000.0f >= static_cast<float>(params.wakeSpawnMs)) {
+            float emitSpacing = 0.0f;
+            const int n = WakeRippleCount(_wakePathLen, params.wakeTrailSpacing, params.wakeTrailMaxRipples, emitSpacing);
+            if (n > 0) {
+                _wakePathLen = std::max(0.0f, _wakePathLen - emitSpacing * static_cast<float>(n));
+                _sinceWakeSeconds = 0.0f;
+                _events.wakeRipples = n;
+                _events.wakeSound = true;
+            }
+        }
+    } else {
+        _haveWakePoint = false;
+        _wakePathLen = 0.0f;
+    }
+
+    _wasInWater = sample.inWater;
+    _havePrev = true;
+    return _events;
+}
+
+} // namespace InteractiveWaterVR
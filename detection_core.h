@@ -0,0 +1,110 @@
+#pragma once
+// detection_core.h - Per-hand water entry/exit and wake decisions
+//
+// Engine independent: works on plain floats so the same code can run outside the game (the offline
+// config tuner replays recorded hand traces through HandDetector with candidate parameters).
+
+#include "motion_filter.h"
+
+namespace InteractiveWaterVR {
+
+// ============================================================================
+// Fixed limits (not exposed in the INI; shared with the offline tuner)
+// ============================================================================
+
+// Maximum speeds beyond which entries/exits are ignored
+constexpr float kMaxEntryDownSpeed = 1500.0f;
+constexpr float kMaxExitUpSpeed = 900.0f;
+constexpr float kProbeTeleportSpeed = 10000.0f;  // raw probe speeds above this re-seed the motion filter
+constexpr float kStationaryConfirmSeconds = 1.5f;
+constexpr float kMinWakeDepthMeters = 2.0f;
+
+// ============================================================================
+// Detection parameters
+// ============================================================================
+
+struct DetectionParams {
+    MotionFilterParams filter;
+    float movingThreshold;        // [Movement] MovingThreshold
+    float movingConfirmSeconds;   // [Movement] MovingConfirmSeconds
+    float stationarySeconds;      // below the threshold this long before stationary again
+    float entryMinDownSpeed;      // [Movement] EntryDownZThreshold
+    float entryMaxDownSpeed;      // faster entries are tracking jumps, not splashes
+    float exitMinUpSpeed;         // [Movement] ExitUpZThreshold
+    float exitMaxUpSpeed;
+    float minWakeDepth;           // hand depth below the surface before it drags a wake
+    int wakeSpawnMs;              // [Wake] SpawnMs (0 = every tick)
+    float wakeTrailSpacing;       // [Wake] TrailSpacing
+    int wakeTrailMaxRipples;      // [Wake] TrailMaxRipples
+};
+
+// ============================================================================
+// Decisions
+// ============================================================================
+
+struct HandTransition {
+    bool entered = false;   // the hand went under the surface this tick
+    bool exited = false;    // the hand came out this tick
+    bool splash = false;    // the transition's vertical speed is inside the splash band
+    float speed = 0.0f;     // entry: downward speed, exit: upward speed (units/s; 0 without a velocity)
+};
+
+// Surface crossing of one hand between two ticks. haveVelocity is false on the first tick after a
+// (re)start, whose velocity is meaningless: the crossing still counts but never splashes.
+HandTransition DetectTransition(bool inWater, bool wasInWater, bool haveVelocity, float velZ,
+                                const DetectionParams& params);
+
+// A submerged hand drags a wake when it moves faster than half the moving threshold and is deep enough
+bool WakeActive(bool inWater, float speed, float depth, const DetectionParams& params);
+
+// Ripples one emission lays along pathLen of collected path: one per spacing, at most maxRipples (a
+// longer path widens the spacing instead). emitSpacing receives the spacing actually used.
+int WakeRippleCount(float pathLen, float spacing, int maxRipples, float& emitSpacing);
+
+// ============================================================================
+// Hand detector (offline replay)
+// ============================================================================
+
+struct HandSample {
+    float x = 0.0f;
+    float y = 0.0f;
+    float z = 0.0f;
+    bool inWater = false;
+    float surfaceZ = 0.0f;   // valid when inWater
+};
+
+struct HandEvents {
+    HandTransition transition;
+    int wakeRipples = 0;      // wake ripples emitted this tick
+    bool wakeSound = false;   // a wake emission tried to play the move sound
+};
+
+// The monitor's per-hand pipeline without the game: motion filter, movement hysteresis, surface
+// crossings and the wake trail's emission cadence. The wake path is tracked as arc length only
+// (no ripple positions or amplitudes), which is all the counts need. Stroke-timed wakes are not
+// modelled: they need the player's heading, which a hand trace does not carry.
+class HandDetector {
+public:
+    void Reset();
+
+    // Feed one tick taken dt seconds after the previous one
+    const HandEvents& Update(const HandSample& sample, float dt, const DetectionParams& params);
+
+    const MotionState& Motion() const { return _motion; }
+    bool IsMoving() const { return _movement.IsMoving(); }
+
+private:
+    MotionFilter _filter;
+    MovementDetector _movement;
+    MotionState _motion;
+    HandEvents _events;
+    bool _havePrev = false;
+    bool _wasInWater = false;
+    bool _haveWakePoint = false;
+    float _wakeX = 0.0f;
+    float _wakeY = 0.0f;
+    float _wakePathLen = 0.0f;
+    float _sinceWakeSeconds = 1.0e9f;
+};
+
+} // namespace InteractiveWaterVR
@@ -2,10 +2,20 @@
 #include <SKSE/SKSE.h>
 #include "higgsinterface.h"
 #include "helper.h"
+#include "main_thread_tasks.h"
 #include "water_coll_det.h"
-#include <thread>
+#include "config.h"
+#include "worker_runtime.h"
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <vector>
 #include <atomic>
 #include <string>
+#include <string_view>
 #include <mutex>
 
 namespace InteractiveWaterVR
@@ -17,12 +27,74 @@ namespace InteractiveWaterVR
 	// Generation token to invalidate previously scheduled start tasks
 	static std::atomic<uint32_t> s_startGeneration{0};
 
-	// Ensure SpellInteractions logging runs only once per game session (reset on load)
+	// Ensure SpellInteractions logging runs only once per process
 	static std::atomic<bool> s_spellLogged{false};
 
-	// Track reschedule count to prevent infinite loops
-	static std::atomic<int> s_rescheduleCount{0};
-	static constexpr int kMaxReschedules = 60; // Give up after 60 attempts (~60 seconds)
+	// Generation of the deferred start task queued on the main thread (only one may be in flight per
+	// generation), or kNoPendingStart. A task queued before a load never blocks requests after it.
+	static constexpr uint32_t kNoPendingStart = UINT32_MAX;
+	static std::atomic<uint32_t> s_startTaskPendingGeneration{kNoPendingStart};
+
+	// After a failed start, one follow-up attempt every kStartRetryDelay until the player is ready: the
+	// load events that would otherwise request it may already have fired
+	static constexpr int kMaxStartRetries = 60;
+	static constexpr auto kStartRetryDelay = std::chrono::milliseconds(100);
+
+	// Set by ResetAllRuntimeState, cleared once StartMod succeeds. Lets kPostLoadGame skip a second
+	// full reset when kPreLoadGame already performed one for the same load.
+	static std::atomic<bool> s_stateResetSinceStart{false};
+
+	// Sink for the engine events that mean the player's 3D is ready: the player's own 3D being loaded,
+	// or the player reference being attached to a cell. Either one requests a single deferred start.
+	class PlayerReadyEventSink :
+		public RE::BSTEventSink<RE::TESObjectLoadedEvent>,
+		public RE::BSTEventSink<RE::TESCellAttachDetachEvent>
+	{
+	public:
+		static PlayerReadyEventSink* GetSingleton()
+		{
+			static PlayerReadyEventSink singleton;
+			return &singleton;
+		}
+
+		// Events raised while a save is still loading are ignored; kPostLoadGame makes the first attempt itself.
+		RE::BSEventNotifyControl ProcessEvent(const RE::TESObjectLoadedEvent* a_event, RE::BSTEventSource<RE::TESObjectLoadedEvent>*) override
+		{
+			if (a_event && a_event->loaded && a_event->formID == 0x14 && !IsGameLoadInProgress()) {
+				RequestDeferredStart("player 3D loaded");
+			}
+			return RE::BSEventNotifyControl::kContinue;
+		}
+
+		RE::BSEventNotifyControl ProcessEvent(const RE::TESCellAttachDetachEvent* a_event, RE::BSTEventSource<RE::TESCellAttachDetachEvent>*) override
+		{
+			if (a_event && a_event->attached && a_event->reference && a_event->reference->IsPlayerRef() && !IsGameLoadInProgress()) {
+				RequestDeferredStart("player cell attach");
+			}
+			return RE::BSEventNotifyControl::kContinue;
+		}
+
+		static void RequestDeferredStart(const char* a_reason);
+	};
+
+	static std::atomic<bool> s_startSinksRegistered{false};
+
+	static void RegisterStartEventSinks()
+	{
+		if (s_startSinksRegistered.exchange(true)) {
+			return;
+		}
+		auto holder = RE::ScriptEventSourceHolder::GetSingleton();
+		if (!holder) {
+			IW_LOG_WARN("RegisterStartEventSinks: ScriptEventSourceHolder not available");
+			s_startSinksRegistered.store(false);
+			return;
+		}
+		auto sink = PlayerReadyEventSink::GetSingleton();
+		holder->AddEventSink<RE::TESObjectLoadedEvent>(sink);
+		holder->AddEventSink<RE::TESCellAttachDetachEvent>(sink);
+		IW_LOG_INFO("RegisterStartEventSinks: listening for player 3D load / cell attach");
+	}
 
 	void ResetAllRuntimeState()
 	{
@@ -34,13 +106,7 @@ namespace InteractiveWaterVR
 		// Reset module started flag so StartMod can run again
 		s_modStarted.store(false);
 		
-		// Reset spell logging flag so it logs again for new session
-		s_spellLogged.store(false);
-		
-		// Reset reschedule counter
-		s_rescheduleCount.store(0);
-		
-		// Stop monitoring thread so it can be restarted fresh
+		// Stop the monitor job so it can be restarted fresh
 		StopWaterMonitoring();
 		
 		// CRITICAL: Clear all cached form pointers from previous session
@@ -49,6 +115,17 @@ namespace InteractiveWaterVR
 		
 		// Notify that we're in a load state
 		NotifyGameLoadStart();
+
+		s_stateResetSinceStart.store(true);
+	}
+
+	void EnsureRuntimeStateReset()
+	{
+		if (s_stateResetSinceStart.load()) {
+			IW_LOG_INFO("EnsureRuntimeStateReset: state already reset for this load, skipping");
+			return;
+		}
+		ResetAllRuntimeState();
 	}
 
 	void CancelScheduledStartMod()
@@ -57,13 +134,103 @@ namespace InteractiveWaterVR
 		s_startGeneration.fetch_add(1, std::memory_order_acq_rel);
 		// reset mod started flag so future loads can start fresh
 		s_modStarted.store(false);
-		// reset reschedule count
-		s_rescheduleCount.store(0);
+	}
+
+	// One SpellInteractionsVR record copied out of the form map so it can be formatted off the main thread
+	struct PluginRecordSnapshot
+	{
+		std::uint32_t formID;
+		RE::FormType formType;
+		std::string editorID;
+		std::string name;
+	};
+
+	// Local (per-plugin) form IDs start at 0x800 and stay below the next object ID in the plugin's
+	// header. Without a readable header, probing stops after this many consecutive unused IDs.
+	// Light (ESL-flagged) plugins load as 0xFE000000 | (light index << 12) with a 12-bit local range.
+	static constexpr std::uint32_t kPluginFirstLocalFormId = 0x800;
+	static constexpr std::uint32_t kPluginLastLocalFormId = 0xFFFFFF;
+	static constexpr std::uint32_t kLightPluginLastLocalFormId = 0xFFF;
+	static constexpr std::uint32_t kLightPluginPrefix = 0xFE000000;
+	static constexpr std::uint32_t kPluginFormIdMissRun = 0x400;
+
+	// Next object ID from the plugin's TES4 header (HEDR), read from the file itself so no TESFile
+	// layout is assumed. Returns 0 if the header cannot be read.
+	static std::uint32_t ReadPluginNextObjectId(std::string_view fileName)
+	{
+		std::ifstream in(std::filesystem::path("Data") / std::filesystem::path(fileName), std::ios::binary);
+		if (!in) {
+			return 0;
+		}
+		// 24-byte TES4 record header, then HEDR: type, u16 size, f32 version, u32 record count, u32 next object ID
+		unsigned char header[24 + 6 + 12] = {};
+		if (!in.read(reinterpret_cast<char*>(header), sizeof(header))) {
+			return 0;
+		}
+		if (std::memcmp(header, "TES4", 4) != 0 || std::memcmp(header + 24, "HEDR", 4) != 0) {
+			return 0;
+		}
+		const std::uint16_t hedrSize = static_cast<std::uint16_t>(header[28] | (header[29] << 8));
+		if (hedrSize < 12) {
+			return 0;
+		}
+		std::uint32_t nextObjectId = 0;
+		std::memcpy(&nextObjectId, header + 30 + 8, sizeof(nextObjectId));
+		return nextObjectId & kPluginLastLocalFormId;
+	}
+
+	// Collect the plugin's records by probing its FormID range instead of walking every form in the game.
+	// With the header's next object ID the whole range is probed; otherwise a run of misses ends it.
+	// `prefix` is the load-order part of the FormID and `lastLocal` the top of the plugin's local range.
+	static std::vector<PluginRecordSnapshot> SnapshotPluginRecords(std::uint32_t prefix, std::uint32_t lastLocal, std::uint32_t nextObjectId)
+	{
+		auto allFormsPair = RE::TESForm::GetAllForms();
+		if (!allFormsPair.first) {
+			return {};
+		}
+		auto& allFormsMap = *allFormsPair.first;
+		auto& lock = allFormsPair.second.get();
+
+		const bool bounded = nextObjectId > kPluginFirstLocalFormId;
+		const std::uint32_t end = bounded ? (std::min)(nextObjectId, lastLocal + 1) : lastLocal + 1;
+		std::vector<RE::TESForm*> forms;
+		std::uint32_t local = kPluginFirstLocalFormId;
+		std::uint32_t misses = 0;
+		while (local < end && (bounded || misses < kPluginFormIdMissRun)) {
+			// The whole window is reserved before locking so push_back never reallocates under the lock.
+			// Unbounded probing locks one miss-run window at a time instead of reserving the full range.
+			const std::uint32_t windowEnd = bounded ? end : (std::min)(end, local + kPluginFormIdMissRun);
+			forms.reserve(forms.size() + (windowEnd - local));
+			RE::BSReadLockGuard guard{ lock };
+			for (; local < windowEnd && (bounded || misses < kPluginFormIdMissRun); ++local) {
+				auto it = allFormsMap.find(prefix | local);
+				if (it == allFormsMap.end() || !it->second) {
+					++misses;
+					continue;
+				}
+				misses = 0;
+				forms.push_back(it->second);
+			}
+		}
+
+		// Forms are immutable after kDataLoaded, so names can be copied without holding the map lock
+		std::vector<PluginRecordSnapshot> records;
+		records.reserve(forms.size());
+		for (auto form : forms) {
+			const char* editorID = form->GetFormEditorID();
+			const char* name = form->GetName();
+			records.push_back(PluginRecordSnapshot{
+				form->GetFormID(),
+				form->GetFormType(),
+				(editorID && *editorID) ? std::string(editorID) : std::string("<none>"),
+				(name && *name) ? std::string(name) : std::string("<none>") });
+		}
+		return records;
 	}
 
 	void LogSpellInteractionsVRLoaded()
 	{
-		// Only run once per game session
+		// Only run once per process; the plugin's records do not change between saves
 		bool expected = false;
 		if (!s_spellLogged.compare_exchange_strong(expected, true)) {
 			return;
@@ -76,71 +243,76 @@ namespace InteractiveWaterVR
 			return;
 		}
 
-		const auto mod = handler->LookupLoadedModByName("SpellInteractionsVR.esp");
-		if (mod) {
-			auto idx = handler->GetLoadedModIndex("SpellInteractionsVR.esp");
-			if (idx && *idx != 0xFF) {
-				unsigned int modIndex = static_cast<unsigned int>(*idx);
-				SKSE::log::info("SpellInteractionsVR.esp is loaded. Mod index:0x{:02X}", modIndex);
-				InteractiveWaterVR::AppendToPluginLog("INFO", "SpellInteractionsVR.esp is loaded. Mod index:0x%02X", modIndex);
-			} else {
-				IW_LOG_WARN("SpellInteractionsVR.esp is loaded but mod index invalid");
-			}
+		const RE::TESFile* mod = handler->LookupLoadedModByName("SpellInteractionsVR.esp");
+		if (!mod) {
+			mod = handler->LookupLoadedLightModByName("SpellInteractionsVR.esp");
+		}
+		if (!mod) {
+			IW_LOG_WARN("SpellInteractionsVR.esp is NOT loaded");
+			return;
+		}
 
-			auto allFormsPair = RE::TESForm::GetAllForms();
-			auto& allFormsMap = *allFormsPair.first;
-			auto& lock = allFormsPair.second.get();
-			std::size_t found = 0;
-			{
-				RE::BSReadLockGuard guard{ lock };
-				for (const auto& kv : allFormsMap) {
-					const auto form = kv.second;
-					if (!form) {
-						continue;
-					}
-					const auto file = form->GetFile();
-					if (file == mod) {
-						++found;
-						const char* editorID = form->GetFormEditorID();
-						const char* name = form->GetName();
-
-						std::string typeStr;
-						auto typeView = RE::FormTypeToString(form->GetFormType());
-						if (!typeView.empty()) {
-							typeStr = std::string(typeView);
-						} else {
-							typeStr = "<none>";
-						}
-
-						std::string editorIDStr = (editorID && *editorID) ? std::string(editorID) : std::string("<none>");
-						std::string nameStr = (name && *name) ? std::string(name) : std::string("<none>");
-
-						SKSE::log::info(
-							"SpellInteractionsVR record #{}: FormID0x{:08X} Type {} EditorID '{}' Name '{}'",
-							found,
-							static_cast<unsigned int>(form->GetFormID()),
-							typeStr,
-							editorIDStr,
-							nameStr);
-
-						InteractiveWaterVR::AppendToPluginLog(
-							"INFO",
-							"SpellInteractionsVR record #%zu: FormID0x%08X Type %s EditorID '%s' Name '%s'",
-							found,
-							static_cast<unsigned int>(form->GetFormID()),
-							typeStr.c_str(),
-							editorIDStr.c_str(),
-							nameStr.c_str());
-					}
-				}
+		// FormID prefix from the file's compile index: full plugins own the top byte, light plugins
+		// share 0xFE and own 12 bits below it
+		std::uint32_t prefix = 0;
+		std::uint32_t lastLocal = kPluginLastLocalFormId;
+		if (mod->IsLight()) {
+			const unsigned int lightIndex = mod->GetSmallFileCompileIndex();
+			if (lightIndex > 0xFFF) {
+				IW_LOG_WARN("SpellInteractionsVR.esp is loaded but light index invalid");
+				return;
+			}
+			prefix = kLightPluginPrefix | (static_cast<std::uint32_t>(lightIndex) << 12);
+			lastLocal = kLightPluginLastLocalFormId;
+			IW_LOG_INFO("SpellInteractionsVR.esp is loaded. Light index:0x%03X", lightIndex);
+		} else {
+			const unsigned int modIndex = mod->GetCompileIndex();
+			if (modIndex >= 0xFE) {
+				IW_LOG_WARN("SpellInteractionsVR.esp is loaded but mod index invalid");
+				return;
 			}
+			prefix = static_cast<std::uint32_t>(modIndex) << 24;
+			IW_LOG_INFO("SpellInteractionsVR.esp is loaded. Mod index:0x%02X", modIndex);
+		}
 
-			SKSE::log::info("SpellInteractionsVR.esp: logged {} records", found);
-			InteractiveWaterVR::AppendToPluginLog("INFO", "SpellInteractionsVR.esp: logged %zu records", found);
+		if (!cfgLogPluginRecords) {
+			return;
+		}
 
-		} else {
-			IW_LOG_WARN("SpellInteractionsVR.esp is NOT loaded");
+		const std::uint32_t nextObjectId = ReadPluginNextObjectId(mod->GetFilename());
+		if (nextObjectId == 0) {
+			IW_LOG_WARN("SpellInteractionsVR.esp: plugin header not readable - probing form IDs until %u consecutive misses", kPluginFormIdMissRun);
 		}
+		auto started = std::chrono::steady_clock::now();
+		auto records = SnapshotPluginRecords(prefix, lastLocal, nextObjectId);
+		auto snapshotUs = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - started).count();
+		IW_LOG_INFO("SpellInteractionsVR.esp: snapshot of %zu records (next object ID 0x%06X) took %lld us", records.size(),
+			static_cast<unsigned int>(nextObjectId), static_cast<long long>(snapshotUs));
+
+		// Formatting and file output happen on a worker from the copied snapshot
+		ScheduleJob(JobType::RecordDump, JobDelay::zero(), [records = std::move(records)]() -> JobDelay {
+			try {
+				std::vector<std::string> lines;
+				lines.reserve(records.size() + 1);
+				char buf[512];
+				std::size_t n = 0;
+				for (const auto& rec : records) {
+					++n;
+					auto typeView = RE::FormTypeToString(rec.formType);
+					std::string typeStr = typeView.empty() ? std::string("<none>") : std::string(typeView);
+					std::snprintf(buf, sizeof(buf), "SpellInteractionsVR record #%zu: FormID0x%08X Type %s EditorID '%s' Name '%s'",
+						n, static_cast<unsigned int>(rec.formID), typeStr.c_str(), rec.editorID.c_str(), rec.name.c_str());
+					SKSE::log::info("{}", buf);
+					lines.emplace_back(buf);
+				}
+				std::snprintf(buf, sizeof(buf), "SpellInteractionsVR.esp: logged %zu records", records.size());
+				SKSE::log::info("{}", buf);
+				lines.emplace_back(buf);
+				InteractiveWaterVR::AppendLinesToPluginLog("INFO", lines);
+			} catch (...) {
+			}
+			return kJobDone;
+		});
 	}
 
 	// Internal function that does the actual initialization work
@@ -207,25 +379,76 @@ namespace InteractiveWaterVR
 		if (TryInitialize()) {
 			// Success! Mark as started
 			s_modStarted.store(true);
+			s_stateResetSinceStart.store(false);
 			IW_LOG_INFO("StartMod: initialization successful");
-			
-			// Schedule logging of SpellInteractionsVR records after a short delay
-			std::thread([]() {
-				std::this_thread::sleep_for(std::chrono::seconds(3));
-				auto taskIntf = SKSE::GetTaskInterface();
-				if (taskIntf) {
-					taskIntf->AddTask([]() { LogSpellInteractionsVRLoaded(); });
-				} else {
-					LogSpellInteractionsVRLoaded();
-				}
-			}).detach();
 		} else {
-			// Failed - will be retried by ScheduleStartMod polling loop
-			IW_LOG_WARN("StartMod: player not ready yet, waiting for retry...");
+			// Failed - the deferred start task retries shortly; player 3D load / cell attach events also request attempts
+			IW_LOG_WARN("StartMod: player not ready yet, retrying shortly or on the next player ready event...");
 		}
 	}
 
-	void ScheduleStartMod(int delaySeconds)
+	// Queue one start attempt for a_generation; the caller has claimed s_startTaskPendingGeneration for it
+	static void QueueStartTask(uint32_t a_generation, int a_attempt)
+	{
+		const bool queued = PostTask(TaskType::ModStart, [a_generation, a_attempt]() {
+			uint32_t pending = a_generation;
+			s_startTaskPendingGeneration.compare_exchange_strong(pending, kNoPendingStart);
+			// Cancelled by a newer load, or already started by another event
+			if (s_startGeneration.load() != a_generation || s_modStarted.load()) {
+				return;
+			}
+			StartMod();
+			if (s_modStarted.load() || s_startGeneration.load() != a_generation) {
+				return;
+			}
+			if (a_attempt >= kMaxStartRetries) {
+				IW_LOG_WARN("RequestDeferredStart: player still not ready after %d attempts, waiting for player ready event", a_attempt + 1);
+				return;
+			}
+			// Not a session job: a stale retry is dropped by the generation check instead
+			uint32_t none = kNoPendingStart;
+			if (!s_startTaskPendingGeneration.compare_exchange_strong(none, a_generation)) {
+				return;
+			}
+			const JobHandle retry = ScheduleJob(JobType::StartRetry, kStartRetryDelay, [a_generation, a_attempt]() -> JobDelay {
+				QueueStartTask(a_generation, a_attempt + 1);
+				return kJobDone;
+			});
+			if (!retry.Valid()) {
+				uint32_t pending = a_generation;
+				s_startTaskPendingGeneration.compare_exchange_strong(pending, kNoPendingStart);
+			}
+		});
+		if (!queued) {
+			uint32_t pending = a_generation;
+			s_startTaskPendingGeneration.compare_exchange_strong(pending, kNoPendingStart);
+		}
+	}
+
+	void PlayerReadyEventSink::RequestDeferredStart(const char* a_reason)
+	{
+		if (s_modStarted.load()) {
+			return;
+		}
+		// Coalesce: only one start task may be queued per generation; a task left from an older
+		// generation is superseded (it will see the generation change and do nothing)
+		const uint32_t myGeneration = s_startGeneration.load();
+		if (s_startTaskPendingGeneration.exchange(myGeneration) == myGeneration) {
+			return;
+		}
+
+		auto taskIntf = SKSE::GetTaskInterface();
+		if (!taskIntf) {
+			s_startTaskPendingGeneration.store(kNoPendingStart);
+			IW_LOG_WARN("RequestDeferredStart: task interface not available (%s)", a_reason);
+			return;
+		}
+
+		IW_LOG_INFO("RequestDeferredStart: queuing start task (%s)", a_reason);
+		QueueStartTask(myGeneration, 0);
+	}
+
+	void ScheduleStartMod()
 	{
 		// If already started, nothing to do
 		if (s_modStarted.load()) {
@@ -233,100 +456,11 @@ namespace InteractiveWaterVR
 			return;
 		}
 
-		IW_LOG_INFO("ScheduleStartMod: starting initialization polling (delay=%d seconds)", delaySeconds);
+		RegisterStartEventSinks();
 
-		// Capture the current generation to detect cancellation
-		uint32_t myGeneration = s_startGeneration.load();
-
-		// Launch a polling thread that will keep trying until success or cancellation
-		std::thread([delaySeconds, myGeneration]() {
-			try {
-				// Initial delay
-				std::this_thread::sleep_for(std::chrono::seconds(delaySeconds));
-				
-				int attempts = 0;
-				
-				// Keep polling until we succeed, get cancelled, or hit max attempts
-				while (attempts < kMaxReschedules) {
-					// Check if cancelled
-					if (s_startGeneration.load() != myGeneration) {
-						IW_LOG_INFO("ScheduleStartMod: cancelled (generation mismatch)");
-						return;
-					}
-					
-					// Check if already started by another path
-					if (s_modStarted.load()) {
-						IW_LOG_INFO("ScheduleStartMod: module already started by another path");
-						return;
-					}
-					
-					attempts++;
-					IW_LOG_INFO("ScheduleStartMod: attempt %d of %d", attempts, kMaxReschedules);
-					
-					// Try to initialize on the main thread
-					auto taskIntf = SKSE::GetTaskInterface();
-					if (taskIntf) {
-						// Use a flag to communicate success back
-						std::atomic<bool> tryResult{false};
-						std::atomic<bool> taskDone{false};
-						
-						taskIntf->AddTask([&tryResult, &taskDone, myGeneration]() {
-							// Check cancellation again on main thread
-							if (s_startGeneration.load() != myGeneration || s_modStarted.load()) {
-								taskDone.store(true);
-								return;
-							}
-							
-							if (TryInitialize()) {
-								s_modStarted.store(true);
-								tryResult.store(true);
-								IW_LOG_INFO("ScheduleStartMod: initialization successful on main thread");
-								
-								// Schedule spell logging
-								std::thread([]() {
-									std::this_thread::sleep_for(std::chrono::seconds(3));
-									auto ti = SKSE::GetTaskInterface();
-									if (ti) {
-										ti->AddTask([]() { LogSpellInteractionsVRLoaded(); });
-									} else {
-										LogSpellInteractionsVRLoaded();
-									}
-								}).detach();
-							}
-							taskDone.store(true);
-						});
-						
-						// Wait for task to complete (with timeout)
-						int waitMs = 0;
-						while (!taskDone.load() && waitMs < 5000) {
-							std::this_thread::sleep_for(std::chrono::milliseconds(50));
-							waitMs += 50;
-						}
-						
-						if (tryResult.load()) {
-							// Success!
-							return;
-						}
-					} else {
-						// No task interface - try directly (risky but better than nothing)
-						if (TryInitialize()) {
-							s_modStarted.store(true);
-							IW_LOG_INFO("ScheduleStartMod: initialization successful (direct)");
-							return;
-						}
-					}
-					
-					// Wait before next attempt
-					std::this_thread::sleep_for(std::chrono::seconds(1));
-				}
-				
-				IW_LOG_ERROR("ScheduleStartMod: exceeded max attempts (%d), giving up", kMaxReschedules);
-				
-			} catch (const std::exception& e) {
-				IW_LOG_ERROR("ScheduleStartMod: exception: %s", e.what());
-			} catch (...) {
-				IW_LOG_ERROR("ScheduleStartMod: unknown exception");
-			}
-		}).detach();
+		// The player's 3D is frequently already loaded by the time kPostLoadGame / kNewGame arrive, in which case
+		// no further load event will fire for it. Try once right away; if the player isn't ready yet the sinks
+		// registered above request the start as soon as the engine reports it.
+		PlayerReadyEventSink::RequestDeferredStart("load message");
 	}
 } // namespace InteractiveWaterVR
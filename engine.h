@@ -15,15 +15,21 @@ namespace InteractiveWaterVR
 	// This clears cached pointers, static flags, and prepares for fresh initialization
 	void ResetAllRuntimeState();
 
+	// Reset runtime state unless ResetAllRuntimeState already ran since the last successful start
+	// (kPreLoadGame followed by kPostLoadGame for the same load only needs one reset).
+	void EnsureRuntimeStateReset();
+
 	// Entry point called once init is complete and dependent APIs are available.
 	void StartMod();
 
-	// Schedule StartMod to run after a delay (seconds). Safe to call multiple times; only one scheduled start will run.
-	void ScheduleStartMod(int delaySeconds = 2);
+	// Arm event-driven start: StartMod runs as a single deferred main-thread task once the player's 3D is
+	// loaded (TESObjectLoadedEvent) or the player is attached to a cell. Safe to call multiple times.
+	void ScheduleStartMod();
 
 	// Cancel any pending scheduled StartMod and reset internal start state.
 	void CancelScheduledStartMod();
 
-	// Log whether SpellInteractionsVR.esp is loaded when game data is ready
+	// Log whether SpellInteractionsVR.esp is loaded when game data is ready. With LogPluginRecords=1 the plugin's
+	// records are also snapshotted by FormID range and written to the log from a background thread.
 	void LogSpellInteractionsVRLoaded();
 }
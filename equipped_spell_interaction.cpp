@@ -2,19 +2,23 @@
 #include "water_coll_det.h"
 #include "config.h"
 #include "helper.h"
-#include <thread>
+#include "main_thread_tasks.h"
+#include "ref_spawn.h"
+#include "worker_runtime.h"
 #include <atomic>
 #include <chrono>
+#include <mutex>
 #include <random>
 #include <numbers>
 #include <SKSE/SKSE.h>
 #include <RE/Skyrim.h>
-#include <functional>
 
 namespace InteractiveWaterVR {
 
-static std::atomic<bool> s_threadRunning{false};
-static std::thread s_thread;
+// Guards the monitor and spawner job handles; never held across CancelJob, since the job being
+// cancelled may itself be waiting for it
+static std::mutex s_jobMutex;
+static JobHandle s_monitorJob;
 
 // Delay before unequip (ms) - requirement: flag must remain true for this duration
 // Reduced to be more responsive to short noisy flag transitions
@@ -65,10 +69,8 @@ static RE::TESObjectSTAT* s_frostChargeStaticForm = nullptr;
 static std::uint32_t s_frostChargeStaticFullId =0;
 static RE::NiPointer<RE::TESObjectREFR> s_leftFrostChargeStaticRef;
 static RE::NiPointer<RE::TESObjectREFR> s_rightFrostChargeStaticRef;
-static std::atomic<bool> s_leftFrostChargeSpawnerRunning{false};
-static std::atomic<bool> s_rightFrostChargeSpawnerRunning{false};
-static std::thread s_leftFrostChargeSpawnerThread;
-static std::thread s_rightFrostChargeSpawnerThread;
+static JobHandle s_leftFrostChargeSpawnerJob;
+static JobHandle s_rightFrostChargeSpawnerJob;
 
 static void ScaleDownAndDeleteStatic(RE::NiPointer<RE::TESObjectREFR> ref);
 static void RemoveFrostChargeStatic(bool leftHand, RE::NiPointer<RE::TESObjectREFR> expectedRef = nullptr);
@@ -149,14 +151,19 @@ static float GetRandomFlatYaw()
     return dist(rng);
 }
 
-static void ApplyFlatRandomRotation(RE::TESObjectREFR* ref)
+// One tween step: the scale itself is set on the main thread
+static void PostScaleStep(const RE::NiPointer<RE::TESObjectREFR>& ref, float scale)
 {
-    if (!ref) {
-        return;
+    auto setScale = [ref, scale]() {
+        if (ref) {
+            ref->SetScale(scale);
+        }
+    };
+    if (SKSE::GetTaskInterface()) {
+        PostTask(TaskType::ScaleStep, setScale);
+    } else {
+        setScale();
     }
-    constexpr float kRadToDeg = 180.0f / std::numbers::pi_v<float>;
-    const float yawDegrees = GetRandomFlatYaw() * kRadToDeg;
-    SetAngleFunc(ref, 0.0f, 0.0f, yawDegrees);
 }
 
 static void AnimateFrostChargeScaleUp(RE::NiPointer<RE::TESObjectREFR> ref)
@@ -165,131 +172,97 @@ static void AnimateFrostChargeScaleUp(RE::NiPointer<RE::TESObjectREFR> ref)
         return;
     }
 
-    std::thread([ref]() {
-        auto applyScale = [ref](float scale) {
-            auto task = SKSE::GetTaskInterface();
-            auto setScale = [ref, scale]() {
-                if (ref) {
-                    ref->SetScale(scale);
-                }
-            };
-            if (task) {
-                task->AddTask(setScale);
-            } else {
-                setScale();
-            }
-        };
-
+    ScheduleJob(JobType::ScaleTween, JobDelay::zero(), [ref, step = std::size_t{0}]() mutable -> JobDelay {
+        const float delta = (kFrostChargeScaleMax - kFrostChargeScaleMin) /
+                            static_cast<float>(kFrostChargeScaleUpIterations);
+        float nextScale = kFrostChargeScaleMin + delta * static_cast<float>(step + 1);
+        if (nextScale > kFrostChargeScaleMax) {
+            nextScale = kFrostChargeScaleMax;
+        }
         try {
-            const float delta = (kFrostChargeScaleMax - kFrostChargeScaleMin) /
-                                static_cast<float>(kFrostChargeScaleUpIterations);
-            for (std::size_t i = 0; i < kFrostChargeScaleUpIterations; ++i) {
-                float nextScale = kFrostChargeScaleMin + delta * static_cast<float>(i + 1);
-                if (nextScale > kFrostChargeScaleMax) {
-                    nextScale = kFrostChargeScaleMax;
-                }
-                applyScale(nextScale);
-                std::this_thread::sleep_for(kFrostChargeScaleUpStep);
-            }
+            PostScaleStep(ref, nextScale);
         } catch (...) {
+            return kJobDone;
         }
-    }).detach();
+        return ++step < kFrostChargeScaleUpIterations ? JobDelay(kFrostChargeScaleUpStep) : kJobDone;
+    });
 }
 
 static void StartFrostChargeStaticSpawner(bool leftHand)
 {
-    auto& running = leftHand ? s_leftFrostChargeSpawnerRunning : s_rightFrostChargeSpawnerRunning;
-    auto& worker = leftHand ? s_leftFrostChargeSpawnerThread : s_rightFrostChargeSpawnerThread;
-    if (running.exchange(true)) {
+    std::lock_guard<std::mutex> lock(s_jobMutex);
+    auto& job = leftHand ? s_leftFrostChargeSpawnerJob : s_rightFrostChargeSpawnerJob;
+    if (IsJobScheduled(job)) {
         return;
     }
 
-    worker = std::thread([leftHand]() {
-        auto& flag = leftHand ? s_leftFrostChargeSpawnerRunning : s_rightFrostChargeSpawnerRunning;
-        constexpr auto kSleepStep = std::chrono::milliseconds(50);
-        while (flag.load()) {
-            SpawnFrostChargeStatic(leftHand);
-            auto slept = std::chrono::milliseconds(0);
-            while (flag.load() && slept < kFrostChargeStaticRespawnInterval) {
-                auto remaining = kFrostChargeStaticRespawnInterval - slept;
-                auto slice = remaining < kSleepStep ? remaining : kSleepStep;
-                if (slice.count() > 0) {
-                    std::this_thread::sleep_for(slice);
-                    slept += slice;
-                } else {
-                    break;
-                }
-            }
-        }
+    job = ScheduleJob(JobType::FrostChargeSpawner, JobDelay::zero(), [leftHand]() -> JobDelay {
+        SpawnFrostChargeStatic(leftHand);
+        return kFrostChargeStaticRespawnInterval;
     });
 }
 
 static void StopFrostChargeStaticSpawner(bool leftHand)
 {
-    auto& running = leftHand ? s_leftFrostChargeSpawnerRunning : s_rightFrostChargeSpawnerRunning;
-    auto& worker = leftHand ? s_leftFrostChargeSpawnerThread : s_rightFrostChargeSpawnerThread;
-    if (!running.exchange(false)) {
-        return;
+    JobHandle job;
+    {
+        std::lock_guard<std::mutex> lock(s_jobMutex);
+        auto& slot = leftHand ? s_leftFrostChargeSpawnerJob : s_rightFrostChargeSpawnerJob;
+        job = slot;
+        slot = JobHandle{};
     }
-    if (worker.joinable()) {
-        worker.join();
+    if (!job.Valid()) {
+        return;
     }
+    const long long waitedUs = CancelJob(job);
+    IW_LOG_INFO("StopFrostChargeStaticSpawner: %s spawner stopped in %.2f ms", leftHand ? "left" : "right",
+        static_cast<double>(waitedUs) / 1000.0);
 }
 
-static void ScheduleDespawn(RE::NiPointer<RE::TESObjectREFR> ref, std::function<void()> onDeleted = nullptr)
+// onDeleted is taken as its own callable type rather than a std::function so the continuation is
+// moved straight into the job slot without a type-erased heap copy. A despawn cancelled by a session
+// reset leaves the ref alone (the session is going away).
+template <class OnDeleted>
+static void ScheduleDespawn(RE::NiPointer<RE::TESObjectREFR> ref, OnDeleted onDeleted)
 {
     if (!ref) {
         return;
     }
 
-    std::thread([ref, onDeleted = std::move(onDeleted)]() mutable {
-        constexpr auto kScaleStep = std::chrono::milliseconds(50);
-        constexpr float kMinScale = 0.05f;
-        auto totalMs = std::chrono::duration_cast<std::chrono::milliseconds>(kFrostDespawnDelay).count();
-        auto stepMs = kScaleStep.count();
-        std::size_t steps = stepMs > 0 ? static_cast<std::size_t>(totalMs / stepMs) : 0;
-        auto remainderMs = totalMs - static_cast<long long>(steps) * stepMs;
-
-        auto applyScale = [ref](float scale) {
-            auto task = SKSE::GetTaskInterface();
-            auto setScale = [ref, scale]() {
-                if (ref) {
-                    ref->SetScale(scale);
-                }
-            };
-            if (task) {
-                task->AddTask(setScale);
-            } else {
-                setScale();
-            }
-        };
+    static constexpr auto kScaleStep = std::chrono::milliseconds(50);
+    static constexpr float kMinScale = 0.05f;
+    static constexpr std::size_t kSteps = static_cast<std::size_t>(kFrostDespawnDelay / kScaleStep);
+    static constexpr auto kRemainder = kFrostDespawnDelay - kScaleStep * static_cast<long long>(kSteps);
 
-        try {
-            float currentScale = ref->GetScale();
-            if (currentScale <= 0.0f) {
-                currentScale = 1.0f;
-            }
-            if (currentScale < kMinScale) {
-                currentScale = kMinScale;
-            }
-
-            if (steps == 0) {
-                std::this_thread::sleep_for(kFrostDespawnDelay);
-            } else {
-                const float scaleDelta = (currentScale - kMinScale) / static_cast<float>(steps);
-                for (std::size_t i = 0; i < steps; ++i) {
-                    float nextScale = currentScale - scaleDelta * static_cast<float>(i + 1);
+    // Shrink in kSteps steps, wait out the remainder of kFrostDespawnDelay, then delete
+    auto job = [ref, onDeleted = std::move(onDeleted), step = std::size_t{0}, startScale = 0.0f]() mutable -> JobDelay {
+        if (step <= kSteps) {
+            try {
+                if (step == 0) {
+                    startScale = ref->GetScale();
+                    if (startScale <= 0.0f) {
+                        startScale = 1.0f;
+                    }
+                    if (startScale < kMinScale) {
+                        startScale = kMinScale;
+                    }
+                }
+                if (step < kSteps) {
+                    const float scaleDelta = (startScale - kMinScale) / static_cast<float>(kSteps);
+                    float nextScale = startScale - scaleDelta * static_cast<float>(step + 1);
                     if (nextScale < kMinScale) {
                         nextScale = kMinScale;
                     }
-                    applyScale(nextScale);
-                    std::this_thread::sleep_for(kScaleStep);
+                    PostScaleStep(ref, nextScale);
+                    ++step;
+                    return kScaleStep;
                 }
-                if (remainderMs > 0) {
-                    std::this_thread::sleep_for(std::chrono::milliseconds(remainderMs));
+                if (kRemainder > JobDelay::zero()) {
+                    ++step;
+                    return kRemainder;
                 }
+            } catch (...) {
             }
-        } catch (...) {
         }
 
         try {
@@ -297,13 +270,16 @@ static void ScheduleDespawn(RE::NiPointer<RE::TESObjectREFR> ref, std::function<
         } catch (...) {
         }
 
-        if (onDeleted) {
-            try {
-                onDeleted();
-            } catch (...) {
-            }
+        try {
+            onDeleted();
+        } catch (...) {
         }
-    }).detach();
+        return kJobDone;
+    };
+    if (!ScheduleJob(JobType::Despawn, JobDelay::zero(), std::move(job)).Valid()) {
+        // No job slot: better gone now than never
+        DeleteFunc(ref.get());
+    }
 }
 
 void UnequipSelectedSpellsOnMainThread(RE::PlayerCharacter* player) {
@@ -418,6 +394,37 @@ static void StopShockSelfOnPlayer(RE::PlayerCharacter* player) {
  }
 }
 
+// Spawn transform at the controller: on the water surface when known, flat with a random yaw
+static SpawnSpec MakeFrostSpawnSpec(RE::TESBoundObject* form, RE::PlayerCharacter* player, bool leftHand, float scale)
+{
+ SpawnSpec spec;
+ spec.form = form;
+ spec.position.x = leftHand ? InteractiveWaterVR::s_leftControllerWorldX.load() : InteractiveWaterVR::s_rightControllerWorldX.load();
+ spec.position.y = leftHand ? InteractiveWaterVR::s_leftControllerWorldY.load() : InteractiveWaterVR::s_rightControllerWorldY.load();
+ const float waterZ = InteractiveWaterVR::s_frostSpawnWaterHeight.load();
+ spec.position.z = waterZ != 0.0f ? waterZ : player->GetPosition().z;
+ spec.angle = RE::NiPoint3{ 0.0f, 0.0f, GetRandomFlatYaw() };
+ spec.scale = scale;
+ spec.tag = leftHand ? 1u : 0u;
+ return spec;
+}
+
+// Main thread, straight after the frost movable is placed
+static void OnFrostMovableSpawned(RE::NiPointer<RE::TESObjectREFR> ref, std::uint32_t tag)
+{
+ if (!ref) return;
+ const bool leftHand = tag != 0;
+ auto chargeStaticRef = leftHand ? s_leftFrostChargeStaticRef : s_rightFrostChargeStaticRef;
+ ScheduleDespawn(ref, [leftHand, chargeStaticRef]() {
+ ScheduleJob(JobType::FrostChargeRemoval, kFrostChargeStaticExtraDelay, [leftHand, chargeStaticRef]() -> JobDelay {
+ RemoveFrostChargeStatic(leftHand, chargeStaticRef);
+ return kJobDone;
+ });
+ });
+ const auto pos = ref->GetPosition();
+ IW_LOG_INFO("SpawnFrostMovableInFront: spawned frost movable via %s controller (pos %.3f, %.3f)", leftHand ? "left" : "right", pos.x, pos.y);
+}
+
 // Helper to spawn frost movable static in front of the player on the main thread
 static void SpawnFrostMovableInFront(RE::PlayerCharacter* player, bool leftHand) {
  if (!player) return;
@@ -430,68 +437,16 @@ static void SpawnFrostMovableInFront(RE::PlayerCharacter* player, bool leftHand)
  }
  IW_LOG_INFO("SpawnFrostMovableInFront: loaded Frost form -> fullId=0x%08X", s_frostSpawnFullId);
  }
- // schedule on main thread
- auto task = SKSE::GetTaskInterface();
- float ctrlX = leftHand ? InteractiveWaterVR::s_leftControllerWorldX.load() : InteractiveWaterVR::s_rightControllerWorldX.load();
- float ctrlY = leftHand ? InteractiveWaterVR::s_leftControllerWorldY.load() : InteractiveWaterVR::s_rightControllerWorldY.load();
- if (task) {
- IW_LOG_INFO("SpawnFrostMovableInFront: scheduling spawn for %s controller at (%.3f, %.3f)", leftHand ? "left" : "right", ctrlX, ctrlY);
- 
- task->AddTask([player, leftHand, ctrlX, ctrlY]() {
- if (!player) return;
- try {
- auto ref = player->PlaceObjectAtMe(s_frostSpawnForm, false);
- if (!ref) {
- IW_LOG_WARN("SpawnFrostMovableInFront: PlaceObjectAtMe failed");
- return;
- }
- auto playerPos = player->GetPosition();
- float xOffset = ctrlX - playerPos.x;
- float yOffset = ctrlY - playerPos.y;
- float waterZ = InteractiveWaterVR::s_frostSpawnWaterHeight.load();
- float zOffset = 0.0f;
- if (waterZ != 0.0f) {
- float refZ = ref->GetPosition().z;
- zOffset = waterZ - refZ;
- }
- MoveToFunc(ref.get(), player, xOffset, yOffset, zOffset, true);
- ApplyFlatRandomRotation(ref.get());
- auto chargeStaticRef = leftHand ? s_leftFrostChargeStaticRef : s_rightFrostChargeStaticRef;
- ScheduleDespawn(ref, [leftHand, chargeStaticRef]() {
- std::this_thread::sleep_for(kFrostChargeStaticExtraDelay);
- RemoveFrostChargeStatic(leftHand, chargeStaticRef);
- });
- IW_LOG_INFO("SpawnFrostMovableInFront: spawned frost movable via %s controller (pos %.3f, %.3f)", leftHand ? "left" : "right", ctrlX, ctrlY);
- } catch (...) {
- IW_LOG_WARN("SpawnFrostMovableInFront: exception during spawn task");
- }
- });
+ SpawnSpec spec = MakeFrostSpawnSpec(s_frostSpawnForm, player, leftHand, 1.0f);
+ spec.onSpawned = OnFrostMovableSpawned;
+ if (SKSE::GetTaskInterface()) {
+ IW_LOG_INFO("SpawnFrostMovableInFront: scheduling spawn for %s controller at (%.3f, %.3f)", leftHand ? "left" : "right", spec.position.x, spec.position.y);
+ QueueSpawn(spec);
  } else {
- // Fallback: run inline (should be main thread when called) 
+ // Fallback: run inline (should be main thread when called)
  try {
- IW_LOG_INFO("SpawnFrostMovableInFront: running inline spawn for %s controller at (%.3f, %.3f)", leftHand ? "left" : "right", ctrlX, ctrlY);
- auto ref = player->PlaceObjectAtMe(s_frostSpawnForm, false);
- if (ref) {
- auto playerPos = player->GetPosition();
- float xOffset = ctrlX - playerPos.x;
- float yOffset = ctrlY - playerPos.y;
- float waterZ = InteractiveWaterVR::s_frostSpawnWaterHeight.load();
- float zOffset = 0.0f;
- if (waterZ != 0.0f) {
- float refZ = ref->GetPosition().z;
- zOffset = waterZ - refZ;
- }
- MoveToFunc(ref.get(), player, xOffset, yOffset, zOffset, true);
- ApplyFlatRandomRotation(ref.get());
- auto chargeStaticRef = leftHand ? s_leftFrostChargeStaticRef : s_rightFrostChargeStaticRef;
- ScheduleDespawn(ref, [leftHand, chargeStaticRef]() {
- std::this_thread::sleep_for(kFrostChargeStaticExtraDelay);
- RemoveFrostChargeStatic(leftHand, chargeStaticRef);
- });
- IW_LOG_INFO("SpawnFrostMovableInFront: spawned frost movable via %s controller (pos %.3f, %.3f)", leftHand ? "left" : "right", ctrlX, ctrlY);
- } else {
- IW_LOG_WARN("SpawnFrostMovableInFront: PlaceObjectAtMe failed (inline)");
- }
+ IW_LOG_INFO("SpawnFrostMovableInFront: running inline spawn for %s controller at (%.3f, %.3f)", leftHand ? "left" : "right", spec.position.x, spec.position.y);
+ spec.onSpawned(SpawnReferenceNow(spec), spec.tag);
  } catch (...) {
  IW_LOG_WARN("SpawnFrostMovableInFront: exception during inline spawn");
  }
@@ -511,51 +466,40 @@ static void RemoveFrostChargeStatic(bool leftHand, RE::NiPointer<RE::TESObjectRE
  ScaleDownAndDeleteStatic(ref);
 }
 
-static void SpawnFrostChargeStatic(bool leftHand)
+// Main thread, straight after a charge static is placed: replaces the hand's previous static
+static void OnFrostChargeStaticSpawned(RE::NiPointer<RE::TESObjectREFR> ref, std::uint32_t tag)
 {
- if (!EnsureFrostChargeStaticForm()) return;
- auto player = RE::PlayerCharacter::GetSingleton();
- if (!player) return;
- float ctrlX = leftHand ? InteractiveWaterVR::s_leftControllerWorldX.load() : InteractiveWaterVR::s_rightControllerWorldX.load();
- float ctrlY = leftHand ? InteractiveWaterVR::s_leftControllerWorldY.load() : InteractiveWaterVR::s_rightControllerWorldY.load();
- auto task = SKSE::GetTaskInterface();
- auto spawn = [player, leftHand, ctrlX, ctrlY]() {
- if (!player) return;
- try {
- auto ref = player->PlaceObjectAtMe(s_frostChargeStaticForm, false);
- if (!ref) {
- IW_LOG_WARN("SpawnFrostChargeStatic: PlaceObjectAtMe failed");
- return;
- }
+ if (!ref) return;
+ const bool leftHand = tag != 0;
  auto& stored = leftHand ? s_leftFrostChargeStaticRef : s_rightFrostChargeStaticRef;
  if (stored) {
  auto prev = stored;
  stored.reset();
  ScaleDownAndDeleteStatic(prev);
  }
- ref->SetScale(kFrostChargeScaleMin);
  AnimateFrostChargeScaleUp(ref);
- auto playerPos = player->GetPosition();
- float xOffset = ctrlX - playerPos.x;
- float yOffset = ctrlY - playerPos.y;
- float waterZ = InteractiveWaterVR::s_frostSpawnWaterHeight.load();
- float zOffset = 0.0f;
- if (waterZ != 0.0f) {
- float refZ = ref->GetPosition().z;
- zOffset = waterZ - refZ;
- }
- MoveToFunc(ref.get(), player, xOffset, yOffset, zOffset, true);
- ApplyFlatRandomRotation(ref.get());
  stored = ref;
- IW_LOG_INFO("SpawnFrostChargeStatic: spawned %s hand static at (%.3f, %.3f)", leftHand ? "left" : "right", ctrlX, ctrlY);
+ const auto pos = ref->GetPosition();
+ IW_LOG_INFO("SpawnFrostChargeStatic: spawned %s hand static at (%.3f, %.3f)", leftHand ? "left" : "right", pos.x, pos.y);
+}
+
+static void SpawnFrostChargeStatic(bool leftHand)
+{
+ if (!EnsureFrostChargeStaticForm()) return;
+ auto player = RE::PlayerCharacter::GetSingleton();
+ if (!player) return;
+ // Periodic cosmetic refresh: thinned along with wakes when frames run over budget
+ if (!AdmitCosmetic()) return;
+ SpawnSpec spec = MakeFrostSpawnSpec(s_frostChargeStaticForm, player, leftHand, kFrostChargeScaleMin);
+ spec.onSpawned = OnFrostChargeStaticSpawned;
+ if (SKSE::GetTaskInterface()) {
+ QueueSpawn(spec);
+ } else {
+ try {
+ spec.onSpawned(SpawnReferenceNow(spec), spec.tag);
  } catch (...) {
  IW_LOG_WARN("SpawnFrostChargeStatic: exception during spawn");
  }
- };
- if (task) {
- task->AddTask(spawn);
- } else {
- spawn();
  }
 }
 
@@ -564,34 +508,23 @@ static void ScaleDownAndDeleteStatic(RE::NiPointer<RE::TESObjectREFR> ref)
  if (!ref) {
  return;
  }
- std::thread([ref]() {
- std::this_thread::sleep_for(kFrostChargeScaleDownDelay);
- auto applyScale = [ref](float scale) {
- auto task = SKSE::GetTaskInterface();
- auto setScale = [ref, scale]() {
- if (ref) {
- ref->SetScale(scale);
- }
- };
- if (task) {
- task->AddTask(setScale);
- } else {
- setScale();
- }
- };
+ auto job = [ref, step = std::size_t{0}, startScale = 0.0f]() mutable -> JobDelay {
  try {
- float currentScale = ref->GetScale();
- if (currentScale <= 0.0f) {
- currentScale = 1.0f;
+ if (step == 0) {
+ startScale = ref->GetScale();
+ if (startScale <= 0.0f) {
+ startScale = 1.0f;
+ }
  }
- const float delta = currentScale / static_cast<float>(kFrostChargeStaticScaleIterations);
- for (std::size_t i = 0; i < kFrostChargeStaticScaleIterations; ++i) {
- float nextScale = currentScale - delta * static_cast<float>(i + 1);
+ if (step < kFrostChargeStaticScaleIterations) {
+ const float delta = startScale / static_cast<float>(kFrostChargeStaticScaleIterations);
+ float nextScale = startScale - delta * static_cast<float>(step + 1);
  if (nextScale < 0.0f) {
  nextScale = 0.0f;
  }
- applyScale(nextScale);
- std::this_thread::sleep_for(kFrostChargeStaticScaleStep);
+ PostScaleStep(ref, nextScale);
+ ++step;
+ return kFrostChargeStaticScaleStep;
  }
  } catch (...) {
  }
@@ -599,17 +532,22 @@ static void ScaleDownAndDeleteStatic(RE::NiPointer<RE::TESObjectREFR> ref)
  DeleteFunc(ref.get());
  } catch (...) {
  }
- }).detach();
+ return kJobDone;
+ };
+ if (!ScheduleJob(JobType::Despawn, kFrostChargeScaleDownDelay, std::move(job)).Valid()) {
+ DeleteFunc(ref.get());
+ }
 }
 
-void MonitorThread() {
+// Flag edges and hold timers carried from one spell monitor tick to the next
+struct SpellMonitorState {
  using clock = std::chrono::steady_clock;
  bool prevLeftFire = false;
  bool prevRightFire = false;
  bool handledLeftWhileTrue = false;
  bool handledRightWhileTrue = false;
- auto leftFireTrueSince = clock::time_point{};
- auto rightFireTrueSince = clock::time_point{};
+ clock::time_point leftFireTrueSince{};
+ clock::time_point rightFireTrueSince{};
 
  bool prevShock = false;
  bool prevAnyFrost = false;
@@ -617,15 +555,14 @@ void MonitorThread() {
  bool prevRightFrost = false;
  bool leftFrostHandledWhileTrue = false;
  bool rightFrostHandledWhileTrue = false;
- auto leftFrostTrueSince = clock::time_point{};
- auto rightFrostTrueSince = clock::time_point{};
+ clock::time_point leftFrostTrueSince{};
+ clock::time_point rightFrostTrueSince{};
 
- IW_LOG_INFO("MonitorThread: starting (cfgAutoUnequipFire=%d)", cfgAutoUnequipFire ?1 :0);
+ JobDelay Tick();
+};
 
- while (s_threadRunning.load()) {
+JobDelay SpellMonitorState::Tick() {
  try {
- std::this_thread::sleep_for(std::chrono::milliseconds(100));
-
  auto now = clock::now();
 
  // --- Handle fire unequip per-hand (new behavior) ---
@@ -647,7 +584,7 @@ void MonitorThread() {
  if (player) {
  auto task = SKSE::GetTaskInterface();
  if (task) {
- task->AddTask([player]() {
+ PostTask(TaskType::Unequip, [player]() {
  if (InteractiveWaterVR::s_submergedMagicDamageFireLeft.load()) {
  UnequipSelectedSpellOnMainThread(player, true);
  }
@@ -682,7 +619,7 @@ void MonitorThread() {
  if (player) {
  auto task = SKSE::GetTaskInterface();
  if (task) {
- task->AddTask([player]() {
+ PostTask(TaskType::Unequip, [player]() {
  if (InteractiveWaterVR::s_submergedMagicDamageFireRight.load()) {
  UnequipSelectedSpellOnMainThread(player, false);
  }
@@ -721,7 +658,7 @@ void MonitorThread() {
  if (player) {
  auto task = SKSE::GetTaskInterface();
  if (task) {
- task->AddTask([player]() { CastShockSelfOnPlayer(player); });
+ PostTask(TaskType::ShockCast, [player]() { CastShockSelfOnPlayer(player); });
  } else {
  CastShockSelfOnPlayer(player);
  }
@@ -736,7 +673,7 @@ void MonitorThread() {
  if (player) {
  auto task = SKSE::GetTaskInterface();
  if (task) {
- task->AddTask([player]() { StopShockSelfOnPlayer(player); });
+ PostTask(TaskType::ShockStop, [player]() { StopShockSelfOnPlayer(player); });
  } else {
  StopShockSelfOnPlayer(player);
  }
@@ -814,7 +751,7 @@ void MonitorThread() {
  } catch (...) {
  // ignore
  }
- }
+ return std::chrono::milliseconds(100);
 }
 
 void StartSpellUnequipMonitor() {
@@ -822,13 +759,23 @@ void StartSpellUnequipMonitor() {
  IW_LOG_INFO("StartSpellUnequipMonitor: disabled via configuration");
  return;
  }
- if (s_threadRunning.exchange(true)) return;
- s_thread = std::thread(MonitorThread);
+ std::lock_guard<std::mutex> lock(s_jobMutex);
+ if (IsJobScheduled(s_monitorJob)) return;
+ IW_LOG_INFO("MonitorThread: starting (cfgAutoUnequipFire=%d)", cfgAutoUnequipFire ?1 :0);
+ s_monitorJob = ScheduleJob(JobType::SpellMonitor, std::chrono::milliseconds(100),
+ [state = SpellMonitorState{}]() mutable -> JobDelay { return state.Tick(); });
 }
 
 void StopSpellUnequipMonitor() {
- if (!s_threadRunning.exchange(false)) return;
- if (s_thread.joinable()) s_thread.join();
+ JobHandle job;
+ {
+ std::lock_guard<std::mutex> lock(s_jobMutex);
+ job = s_monitorJob;
+ s_monitorJob = JobHandle{};
+ }
+ if (!job.Valid()) return;
+ const long long waitedUs = CancelJob(job);
+ IW_LOG_INFO("StopSpellUnequipMonitor: spell monitor stopped in %.2f ms", static_cast<double>(waitedUs) / 1000.0);
  StopFrostChargeSound(true);
  StopFrostChargeSound(false);
 }
@@ -837,7 +784,7 @@ void ClearSpellInteractionCachedForms()
 {
 	IW_LOG_INFO("ClearSpellInteractionCachedForms: clearing all cached spell interaction forms");
 	
-	// Stop any running threads first
+	// Stop the monitor and spawner jobs first
 	StopSpellUnequipMonitor();
 	StopFrostChargeStaticSpawner(true);
 	StopFrostChargeStaticSpawner(false);
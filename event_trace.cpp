@@ -0,0 +1,152 @@
+// event_trace.cpp - Binary event trace in a memory-mapped ring file
+
+#include "event_trace.h"
+#include "helper.h"
+#include "config.h"
+#include <chrono>
+#include <string>
+#include <windows.h>
+
+namespace InteractiveWaterVR {
+
+// ============================================================================
+// Ring state
+// ============================================================================
+
+namespace {
+
+HANDLE s_fileHandle = INVALID_HANDLE_VALUE;
+HANDLE s_mappingHandle = nullptr;
+std::atomic<std::uint8_t*> s_view{ nullptr };
+std::uint32_t s_blockCount = 0;
+
+// Writer state, guarded by s_lock. Events are tiny, so a spin lock is cheaper than a mutex here.
+std::atomic_flag s_lock = ATOMIC_FLAG_INIT;
+std::uint32_t s_block = 0;
+std::uint32_t s_seq = 0;
+std::uint32_t s_used = 0;
+std::uint64_t s_lastUs = 0;
+
+std::uint64_t TraceNowUs() {
+    return static_cast<std::uint64_t>(std::chrono::duration_cast<std::chrono::microseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count());
+}
+
+Trace::BlockHeader* BlockAt(std::uint8_t* view, std::uint32_t i) {
+    return reinterpret_cast<Trace::BlockHeader*>(view + static_cast<std::size_t>(Trace::kBlockSize) * (1 + i));
+}
+
+// Start the next block in the ring; seq is cleared first so a reader never mixes old and new events
+void OpenBlock(std::uint8_t* view, std::uint64_t nowUs) {
+    s_block = s_seq == 0 ? 0 : (s_block + 1) % s_blockCount;
+    auto* h = BlockAt(view, s_block);
+    h->seq.store(0, std::memory_order_release);
+    h->used.store(0, std::memory_order_release);
+    h->baseUs = nowUs;
+    h->seq.store(++s_seq, std::memory_order_release);
+    s_used = 0;
+    s_lastUs = nowUs;
+}
+
+std::string DefaultTracePath() {
+    std::string path = GetPluginLogPath();
+    if (path.empty()) return {};
+    const auto dot = path.find_last_of('.');
+    return (dot == std::string::npos ? path : path.substr(0, dot)) + ".trace";
+}
+
+}  // namespace
+
+// ============================================================================
+// Setup
+// ============================================================================
+
+void InitEventTrace() {
+    if (!cfgTraceEnabled || s_mappingHandle) return;
+
+    const std::string path = cfgTraceFile.empty() ? DefaultTracePath() : cfgTraceFile;
+    if (path.empty()) {
+        IW_LOG_WARN("InitEventTrace: no trace path (USERPROFILE unset and [Trace] File empty) - trace disabled");
+        return;
+    }
+
+    s_blockCount = std::max<std::uint32_t>(2, static_cast<std::uint32_t>(cfgTraceSizeKB) * 1024u / Trace::kBlockSize - 1);
+    const DWORD size = static_cast<DWORD>(Trace::kBlockSize) * (s_blockCount + 1);
+
+    // A fresh ring per session: after a crash, read the file before restarting the game
+    s_fileHandle = CreateFileA(path.c_str(), GENERIC_READ | GENERIC_WRITE, FILE_SHARE_READ | FILE_SHARE_WRITE,
+        nullptr, CREATE_ALWAYS, FILE_ATTRIBUTE_NORMAL, nullptr);
+    if (s_fileHandle == INVALID_HANDLE_VALUE) {
+        IW_LOG_WARN("InitEventTrace: could not open '%s' (error %lu) - trace disabled", path.c_str(), GetLastError());
+        return;
+    }
+    s_mappingHandle = CreateFileMappingA(s_fileHandle, nullptr, PAGE_READWRITE, 0, size, nullptr);
+    if (!s_mappingHandle) {
+        IW_LOG_WARN("InitEventTrace: CreateFileMapping failed (error %lu) - trace disabled", GetLastError());
+        CloseHandle(s_fileHandle);
+        s_fileHandle = INVALID_HANDLE_VALUE;
+        return;
+    }
+    auto* view = static_cast<std::uint8_t*>(MapViewOfFile(s_mappingHandle, FILE_MAP_ALL_ACCESS, 0, 0, size));
+    if (!view) {
+        IW_LOG_WARN("InitEventTrace: MapViewOfFile failed (error %lu) - trace disabled", GetLastError());
+        CloseHandle(s_mappingHandle);
+        s_mappingHandle = nullptr;
+        CloseHandle(s_fileHandle);
+        s_fileHandle = INVALID_HANDLE_VALUE;
+        return;
+    }
+
+    // A new file is zero-filled, so every block starts unused; the magic goes in last
+    auto* header = reinterpret_cast<Trace::FileHeader*>(view);
+    header->version = Trace::kVersion;
+    header->blockSize = Trace::kBlockSize;
+    header->blockCount = s_blockCount;
+    header->startSteadyUs = TraceNowUs();
+    header->startUnixMs = static_cast<std::uint64_t>(std::chrono::duration_cast<std::chrono::milliseconds>(
+        std::chrono::system_clock::now().time_since_epoch()).count());
+    header->writerPid = static_cast<std::uint32_t>(GetCurrentProcessId());
+    std::atomic_thread_fence(std::memory_order_release);
+    header->magic = Trace::kMagic;
+
+    OpenBlock(view, header->startSteadyUs);
+    s_view.store(view, std::memory_order_release);
+
+    IW_LOG_INFO("InitEventTrace: tracing to '%s' (%u blocks of %u bytes)", path.c_str(), s_blockCount, Trace::kBlockSize);
+}
+
+// ============================================================================
+// Writers
+// ============================================================================
+
+void TraceEvent(Trace::EventType type, std::uint64_t f0, std::uint64_t f1, std::uint64_t f2) {
+    std::uint8_t* view = s_view.load(std::memory_order_acquire);
+    if (!view) return;
+
+    const std::uint64_t nowUs = TraceNowUs();
+    const std::uint64_t fields[Trace::kMaxFields] = { f0, f1, f2 };
+    const std::size_t fieldCount = Trace::FieldCount(type);
+
+    while (s_lock.test_and_set(std::memory_order_acquire)) {
+    }
+
+    if (s_used + Trace::kMaxEventBytes > Trace::kBlockPayload) OpenBlock(view, nowUs);
+    // nowUs was read before the lock, so another writer may have stamped a later time meanwhile
+    const std::uint64_t t = std::max(nowUs, s_lastUs);
+
+    auto* h = BlockAt(view, s_block);
+    std::uint8_t* out = reinterpret_cast<std::uint8_t*>(h + 1) + s_used;
+    std::size_t n = 0;
+    out[n++] = static_cast<std::uint8_t>(type);
+    n += Trace::PutVarint(out + n, t - s_lastUs);
+    for (std::size_t i = 0; i < fieldCount; ++i) {
+        n += Trace::PutVarint(out + n, fields[i]);
+    }
+    s_used += static_cast<std::uint32_t>(n);
+    s_lastUs = t;
+    h->used.store(s_used, std::memory_order_release);
+
+    s_lock.clear(std::memory_order_release);
+}
+
+} // namespace InteractiveWaterVR
@@ -0,0 +1,53 @@
+#pragma once
+// event_trace.h - Binary event trace in a memory-mapped ring file
+
+#include "event_trace_format.h"
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+
+namespace InteractiveWaterVR {
+
+// ============================================================================
+// Setup
+// ============================================================================
+
+// Map the trace ring ([Trace] Enabled / File / SizeKB). Until this succeeds, events are discarded.
+void InitEventTrace();
+
+// ============================================================================
+// Writers (safe from any thread)
+// ============================================================================
+
+// Append one event; fields beyond the type's field count are ignored
+void TraceEvent(Trace::EventType type, std::uint64_t f0 = 0, std::uint64_t f1 = 0, std::uint64_t f2 = 0);
+
+inline std::uint64_t TraceScaled(float v, float scale) {
+    return static_cast<std::uint64_t>(std::lround(std::max(0.0f, v) * scale));
+}
+
+inline void TraceProbeTransition(Trace::Probe probe, bool entered, float speed) {
+    TraceEvent(Trace::EventType::ProbeTransition, static_cast<std::uint64_t>(probe), entered ? 1 : 0, TraceScaled(speed, 1.0f));
+}
+
+inline void TraceBandChosen(bool exit, unsigned band, float speed) {
+    TraceEvent(Trace::EventType::BandChosen, exit ? 1 : 0, band, TraceScaled(speed, 1.0f));
+}
+
+inline void TraceRipple(bool merged, unsigned source, float amt) {
+    TraceEvent(merged ? Trace::EventType::RippleMerged : Trace::EventType::RippleEmitted, source, TraceScaled(amt, 1e5f));
+}
+
+inline void TraceSoundVoice(std::uint32_t soundId, float volume) {
+    TraceEvent(Trace::EventType::SoundVoice, soundId, TraceScaled(volume, 100.0f));
+}
+
+inline void TraceSpellEdge(bool isLeft, std::uint32_t formId, bool submerged) {
+    TraceEvent(Trace::EventType::SpellEdge, isLeft ? 0 : 1, formId, submerged ? 1 : 0);
+}
+
+inline void TraceSuspension(bool suspended, Trace::SuspendReason reason) {
+    TraceEvent(Trace::EventType::Suspension, suspended ? 1 : 0, static_cast<std::uint64_t>(reason));
+}
+
+} // namespace InteractiveWaterVR
@@ -0,0 +1,154 @@
+#pragma once
+// event_trace_format.h - Binary event trace file layout
+//
+// Engine independent: included by the plugin (writer) and tools/trace_decoder (reader). Bump
+// kVersion whenever the header, block layout or an event's field list changes.
+//
+// File: one FileHeader page, then blockCount fixed-size blocks used as a ring. Each block starts
+// with a BlockHeader; events follow back to back:
+//   u8 type | varint deltaUs (from the previous event in the block, or from baseUs) | varint fields...
+// The number of fields is fixed per type (kFieldCount). Signed values are zigzag-encoded.
+// A block's `used` is advanced only after an event is fully written, so a crash never leaves a
+// torn event visible; `seq` orders blocks (0 = never written).
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+namespace InteractiveWaterVR {
+namespace Trace {
+
+// ============================================================================
+// Identification
+// ============================================================================
+
+constexpr std::uint32_t kMagic = 0x52545749u;  // "IWTR" little-endian
+constexpr std::uint32_t kVersion = 1;
+constexpr std::uint32_t kBlockSize = 4096;
+
+// ============================================================================
+// Events
+// ============================================================================
+
+enum class EventType : std::uint8_t {
+    ProbeTransition = 1,  // probe, entered, speed (units/s)
+    BandChosen,           // kind (0 entry / 1 exit), band, speed (units/s)
+    RippleEmitted,        // source, amplitude x 1e5
+    RippleMerged,         // source, amplitude x 1e5 of the ripple folded in
+    SoundVoice,           // sound id (0 = no voice), volume x 100
+    SpellEdge,            // hand (0 left / 1 right), spell form id, submerged (0/1)
+    Suspension,           // suspended (0/1), reason
+    Count
+};
+
+// Probe ids for ProbeTransition
+enum class Probe : std::uint8_t { LeftHand = 0, RightHand, LeftFoot, RightFoot };
+
+// Reasons for Suspension
+enum class SuspendReason : std::uint8_t { Reset = 0, DeepWater, SneakDepth, Menu, LoadingScreen, GameLoad };
+
+constexpr std::size_t kMaxFields = 3;
+// Largest encoded event: type byte, then up to 1 + kMaxFields varints of at most 10 bytes
+constexpr std::size_t kMaxEventBytes = 1 + 10 * (1 + kMaxFields);
+
+inline std::size_t FieldCount(EventType t) {
+    switch (t) {
+        case EventType::ProbeTransition: return 3;
+        case EventType::BandChosen: return 3;
+        case EventType::RippleEmitted: return 2;
+        case EventType::RippleMerged: return 2;
+        case EventType::SoundVoice: return 2;
+        case EventType::SpellEdge: return 3;
+        case EventType::Suspension: return 2;
+        default: return 0;
+    }
+}
+
+inline const char* EventName(EventType t) {
+    switch (t) {
+        case EventType::ProbeTransition: return "probeTransition";
+        case EventType::BandChosen: return "bandChosen";
+        case EventType::RippleEmitted: return "rippleEmitted";
+        case EventType::RippleMerged: return "rippleMerged";
+        case EventType::SoundVoice: return "soundVoice";
+        case EventType::SpellEdge: return "spellEdge";
+        case EventType::Suspension: return "suspension";
+        default: return "?";
+    }
+}
+
+inline const char* FieldName(EventType t, std::size_t i) {
+    static const char* const kNames[][kMaxFields] = {
+        { "", "", "" },
+        { "probe", "entered", "speed" },
+        { "kind", "band", "speed" },
+        { "source", "amt_e5", "" },
+        { "source", "amt_e5", "" },
+        { "soundId", "volume_pct", "" },
+        { "hand", "formId", "submerged" },
+        { "suspended", "reason", "" },
+    };
+    const auto idx = static_cast<std::size_t>(t);
+    if (idx >= static_cast<std::size_t>(EventType::Count) || i >= kMaxFields) return "";
+    return kNames[idx][i];
+}
+
+// ============================================================================
+// Varints
+// ============================================================================
+
+inline std::size_t PutVarint(std::uint8_t* out, std::uint64_t v) {
+    std::size_t n = 0;
+    while (v >= 0x80) {
+        out[n++] = static_cast<std::uint8_t>(v | 0x80);
+        v >>= 7;
+    }
+    out[n++] = static_cast<std::uint8_t>(v);
+    return n;
+}
+
+// Returns bytes consumed, or 0 if the varint runs past end
+inline std::size_t GetVarint(const std::uint8_t* in, const std::uint8_t* end, std::uint64_t& v) {
+    v = 0;
+    for (std::size_t n = 0; n < 10 && in + n < end; ++n) {
+        v |= static_cast<std::uint64_t>(in[n] & 0x7F) << (7 * n);
+        if (!(in[n] & 0x80)) return n + 1;
+    }
+    return 0;
+}
+
+inline std::uint64_t ZigZag(std::int64_t v) {
+    return (static_cast<std::uint64_t>(v) << 1) ^ static_cast<std::uint64_t>(v >> 63);
+}
+
+inline std::int64_t UnZigZag(std::uint64_t v) {
+    return static_cast<std::int64_t>(v >> 1) ^ -static_cast<std::int64_t>(v & 1);
+}
+
+// ============================================================================
+// File layout
+// ============================================================================
+
+struct FileHeader {
+    std::uint32_t magic;          // written last on open
+    std::uint32_t version;
+    std::uint32_t blockSize;
+    std::uint32_t blockCount;
+    std::uint64_t startSteadyUs;  // writer's steady clock when the trace was opened
+    std::uint64_t startUnixMs;    // wall clock at the same moment
+    std::uint32_t writerPid;
+};
+
+struct BlockHeader {
+    std::atomic<std::uint32_t> seq;   // 1-based open order; 0 = unused
+    std::atomic<std::uint32_t> used;  // committed event bytes after the header
+    std::uint64_t baseUs;             // steady-clock us the first event's delta is taken from
+};
+
+static_assert(std::atomic<std::uint32_t>::is_always_lock_free, "trace block fields must be lock-free to live in a mapped file");
+static_assert(sizeof(FileHeader) <= kBlockSize, "file header must fit in its page");
+
+constexpr std::size_t kBlockPayload = kBlockSize - sizeof(BlockHeader);
+
+} // namespace Trace
+} // namespace InteractiveWaterVR
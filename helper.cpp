@@ -1,4 +1,5 @@
 #include "helper.h"
+#include "main_thread_tasks.h"
 #include <windows.h>
 #include <cstring>
 #include <algorithm>
@@ -42,6 +43,26 @@ namespace InteractiveWaterVR
  ofs << "[" << timebuf << "] [" << level << "] " << msgbuf << std::endl;
  }
 
+ void AppendLinesToPluginLog(const char* level, const std::vector<std::string>& lines)
+ {
+ if (lines.empty()) return;
+ auto path = GetPluginLogPath();
+ if (path.empty()) return;
+
+ std::ofstream ofs(path, std::ios::app);
+ if (!ofs.is_open()) return;
+
+ SYSTEMTIME st;
+ GetLocalTime(&st);
+ char timebuf[64];
+ snprintf(timebuf, sizeof(timebuf), "%04d-%02d-%02d %02d:%02d:%02d", st.wYear, st.wMonth, st.wDay, st.wHour, st.wMinute, st.wSecond);
+
+ for (const auto& line : lines) {
+ ofs << "[" << timebuf << "] [" << level << "] " << line << '\n';
+ }
+ ofs.flush();
+ }
+
  std::uintptr_t Write5Call(std::uintptr_t a_src, std::uintptr_t a_dst) noexcept
  {
  // The original code computed the absolute target from the32-bit displacement at src+1
@@ -123,7 +144,7 @@ namespace InteractiveWaterVR
  }
 
  // Capture parameters by value and post to main thread
- task->AddTask([akSource, xAngle, yAngle, zAngle]() {
+ PostTask(TaskType::SetAngle, [akSource, xAngle, yAngle, zAngle]() {
  auto vm = RE::BSScript::Internal::VirtualMachine::GetSingleton();
  auto setAngleFn = SetAngle.get();
  if (vm && setAngleFn) {
@@ -147,7 +168,7 @@ namespace InteractiveWaterVR
  }
 
  // Capture parameters by value and post to main thread
- task->AddTask([akSource, refObj, xOffset, yOffset, zOffset, matchRotation]() {
+ PostTask(TaskType::MoveTo, [akSource, refObj, xOffset, yOffset, zOffset, matchRotation]() {
  auto vm = RE::BSScript::Internal::VirtualMachine::GetSingleton();
  auto moveToFn = MoveTo.get();
  if (vm && moveToFn) {
@@ -172,7 +193,7 @@ namespace InteractiveWaterVR
  };
  
  if (task) {
- task->AddTask(invoke);
+ PostTask(TaskType::Delete, invoke);
  } else {
  invoke();
  }
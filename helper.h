@@ -3,6 +3,7 @@
 #include <cstdint>
 #include <string>
 #include <optional>
+#include <vector>
 
 #include <SKSE/SKSE.h>
 #include <RE/Skyrim.h>
@@ -15,6 +16,9 @@ using VM = RE::BSScript::Internal::VirtualMachine;
  void AppendToPluginLog(const char* level, const char* fmt, ...);
  std::string GetPluginLogPath();
 
+ // Append several pre-formatted lines to the plugin log with a single file open (for bulk diagnostics)
+ void AppendLinesToPluginLog(const char* level, const std::vector<std::string>& lines);
+
  #define IW_LOG_INFO(fmt, ...) do { SKSE::log::info(fmt, ##__VA_ARGS__); InteractiveWaterVR::AppendToPluginLog("INFO", fmt, ##__VA_ARGS__); } while(0)
  #define IW_LOG_WARN(fmt, ...) do { SKSE::log::warn(fmt, ##__VA_ARGS__); InteractiveWaterVR::AppendToPluginLog("WARN", fmt, ##__VA_ARGS__); } while(0)
  #define IW_LOG_ERROR(fmt, ...) do { SKSE::log::error(fmt, ##__VA_ARGS__); InteractiveWaterVR::AppendToPluginLog("ERROR", fmt, ##__VA_ARGS__); } while(0)
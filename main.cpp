@@ -6,6 +6,14 @@
 #include "helper.h"
 #include "engine.h"
 #include "water_coll_det.h"
+#include "water_thrown_objects.h"
+#include "water_higgs_velocity.h"
+#include "main_thread_tasks.h"
+#include "telemetry.h"
+#include "event_trace.h"
+#include "worker_runtime.h"
+#include "water_suspend.h"
+#include "config.h"
 #include <cstdint>
 #include <fstream>
 #include <cstdlib>
@@ -48,6 +56,9 @@ static void OnSKSEMessage(SKSE::MessagingInterface::Message* msg)
 			SKSE::log::info("Interactive_Water_VR: obtained HIGGS interface, build {}", build);
 			InteractiveWaterVR::AppendToPluginLog("INFO", "Interactive_Water_VR: obtained HIGGS interface, build %lu", build);
 			IW_LOG_INFO("Interactive_Water_VR: obtained HIGGS interface");
+			InteractiveWaterVR::RegisterThrownObjectCallbacks();
+			InteractiveWaterVR::RegisterHiggsVelocityCallbacks();
+			InteractiveWaterVR::RegisterFrameClock();
 		} else {
 			SKSE::log::info("Interactive_Water_VR: HIGGS interface not available on PostPostLoad");
 			IW_LOG_WARN("Interactive_Water_VR: HIGGS interface not available on PostPostLoad");
@@ -57,9 +68,14 @@ static void OnSKSEMessage(SKSE::MessagingInterface::Message* msg)
 	}
 	case SKSE::MessagingInterface::kDataLoaded: {
 		IW_LOG_INFO("Interactive_Water_VR: received kDataLoaded message");
+		InteractiveWaterVR::loadConfig();
+		InteractiveWaterVR::InitTelemetry();
+		InteractiveWaterVR::InitEventTrace();
+		InteractiveWaterVR::StartWorkerRuntime();
+		InteractiveWaterVR::RegisterSuspensionSinks();
 		InteractiveWaterVR::LogSpellInteractionsVRLoaded();
-		// Schedule a module start attempt after data is available
-		InteractiveWaterVR::ScheduleStartMod(2);
+		// Arm the event-driven module start now that data is available
+		InteractiveWaterVR::ScheduleStartMod();
 		break;
 	}
 	case SKSE::MessagingInterface::kPreLoadGame: {
@@ -74,14 +90,15 @@ static void OnSKSEMessage(SKSE::MessagingInterface::Message* msg)
 		IW_LOG_INFO("Interactive_Water_VR: received kPostLoadGame - scheduling module start");
 		InteractiveWaterVR::AppendToPluginLog("INFO", "PostLoadGame: scheduling StartMod (from load event)");
 
-		// CRITICAL: Always reset state here too!
+		// CRITICAL: Make sure state was reset for this load!
 		// kPreLoadGame does NOT fire when loading from the main menu (first load of session)
-		// So we must ensure state is reset here as well to handle that case
-		InteractiveWaterVR::ResetAllRuntimeState();
+		// so reset here unless kPreLoadGame already did it for this load
+		InteractiveWaterVR::EnsureRuntimeStateReset();
 
-		// End the load suspension and schedule fresh initialization
+		// End the load suspension and start as soon as the player is ready
 		InteractiveWaterVR::NotifyGameLoadEnd();
-		InteractiveWaterVR::ScheduleStartMod(2);
+		InteractiveWaterVR::MarkGameLoadFinished();
+		InteractiveWaterVR::ScheduleStartMod();
 		break;
 	}
 	case SKSE::MessagingInterface::kNewGame: {
@@ -92,9 +109,10 @@ static void OnSKSEMessage(SKSE::MessagingInterface::Message* msg)
 		// New games need complete reinitialization just like loading a save
 		InteractiveWaterVR::ResetAllRuntimeState();
 
-		// End the load suspension and schedule fresh initialization
+		// End the load suspension and start as soon as the player is ready
 		InteractiveWaterVR::NotifyGameLoadEnd();
-		InteractiveWaterVR::ScheduleStartMod(2);
+		InteractiveWaterVR::MarkGameLoadFinished();
+		InteractiveWaterVR::ScheduleStartMod();
 		break;
 	}
 	default:
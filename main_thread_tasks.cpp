@@ -0,0 +1,513 @@
+// main_thread_tasks.cpp - Typed, timed main-thread task posting
+
+#include "main_thread_tasks.h"
+#include "telemetry.h"
+#include "helper.h"
+#include "config.h"
+#include "higgsinterface.h"
+#include <SKSE/SKSE.h>
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <mutex>
+#include <string>
+
+namespace InteractiveWaterVR {
+
+// ============================================================================
+// Constants
+// ============================================================================
+
+namespace {
+
+// Log2 microsecond buckets: [0,1), [1,2), [2,4) ... the last bucket takes everything >= 2^(n-2) us
+constexpr std::size_t kHistogramBuckets = 22;
+constexpr std::size_t kRingSize = 512;
+// SKSE drains its queue back to back; a gap longer than this between tasks starts a new frame's batch
+constexpr long long kBatchGapUs = 1000;
+
+// Frame pressure: EMA weight per frame sample (~10 frames to settle, so recovery is gradual), the
+// fraction of the budget where thinning starts, and the span over which it ramps to full
+constexpr float kFrameEmaWeight = 0.1f;
+constexpr float kPressureStart = 0.85f;
+constexpr float kPressureSpan = 0.30f;
+// Normal work is deferred only once pressure is this high
+constexpr float kNormalDeferPressure = 0.75f;
+constexpr std::size_t kMaxDeferredTasks = 256;
+constexpr int kMaxDeferredPerDrain = 32;
+// Slab tasks: enough for the deferred queue plus several frames of undrained posts
+constexpr std::size_t kTaskSlabSize = 512;
+
+long long NowUs() {
+    return std::chrono::duration_cast<std::chrono::microseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+// ============================================================================
+// Histogram
+// ============================================================================
+
+struct LatencyHistogram {
+    std::array<std::atomic<std::uint32_t>, kHistogramBuckets> buckets{};
+    std::atomic<std::uint32_t> maxUs{ 0 };
+
+    void Add(std::uint32_t us) {
+        std::size_t b = 0;
+        for (std::uint32_t v = us; v != 0 && b + 1 < kHistogramBuckets; v >>= 1) ++b;
+        buckets[b].fetch_add(1, std::memory_order_relaxed);
+        if (us > maxUs.load(std::memory_order_relaxed)) maxUs.store(us, std::memory_order_relaxed);
+    }
+
+    // Upper bound of the bucket holding the p-th sample, then cleared for the next window
+    struct Summary {
+        std::uint32_t count = 0;
+        std::uint32_t p50 = 0;
+        std::uint32_t p95 = 0;
+        std::uint32_t max = 0;
+    };
+
+    Summary TakeSummary() {
+        std::array<std::uint32_t, kHistogramBuckets> snap{};
+        Summary s;
+        for (std::size_t i = 0; i < kHistogramBuckets; ++i) {
+            snap[i] = buckets[i].exchange(0, std::memory_order_relaxed);
+            s.count += snap[i];
+        }
+        s.max = maxUs.exchange(0, std::memory_order_relaxed);
+        if (s.count == 0) return s;
+
+        auto percentile = [&](double p) {
+            const auto target = static_cast<std::uint32_t>(p * s.count + 0.5);
+            std::uint32_t seen = 0;
+            for (std::size_t i = 0; i < kHistogramBuckets; ++i) {
+                seen += snap[i];
+                if (seen >= std::max<std::uint32_t>(target, 1)) {
+                    return std::min(i == 0 ? 1u : (1u << i), s.max);
+                }
+            }
+            return s.max;
+        };
+        s.p50 = percentile(0.50);
+        s.p95 = percentile(0.95);
+        return s;
+    }
+};
+
+struct TypeStats {
+    std::atomic<std::uint64_t> total{ 0 };
+    std::atomic<std::uint64_t> execUsTotal{ 0 };
+    LatencyHistogram queue;
+    LatencyHistogram exec;
+};
+
+std::array<TypeStats, kTaskTypeCount> s_stats;
+
+// Ring of recent executions; written only by the main thread
+std::array<TaskRecord, kRingSize> s_ring{};
+std::atomic<std::uint64_t> s_ringWrites{ 0 };
+
+// Frame batches (main thread writes, log reads)
+long long s_lastTaskEndUs = 0;
+std::uint32_t s_batchUs = 0;
+std::atomic<std::uint64_t> s_batches{ 0 };
+std::atomic<std::uint64_t> s_batchUsTotal{ 0 };
+LatencyHistogram s_batchHist;
+std::uint64_t s_lastLoggedBatches = 0;
+std::uint64_t s_lastLoggedBatchUs = 0;
+long long s_batchStartUs = 0;
+
+// ============================================================================
+// Frame clock
+// ============================================================================
+
+std::atomic<bool> s_higgsFrameClock{ false };
+std::atomic<float> s_frameMsEma{ 0.0f };
+std::atomic<float> s_pressure{ 0.0f };
+std::atomic<std::uint32_t> s_cosmeticCalls{ 0 };
+long long s_lastHiggsFrameUs = 0;
+
+void AddFrameSample(float frameMs) {
+    const float budget = std::max(1.0f, cfgFrameBudgetMs);
+    // Ignore gaps that are not frames (menus, loading, idle task queue)
+    if (frameMs <= 0.0f || frameMs > budget * 4.0f) return;
+
+    float ema = s_frameMsEma.load(std::memory_order_relaxed);
+    ema = ema <= 0.0f ? frameMs : ema + kFrameEmaWeight * (frameMs - ema);
+    s_frameMsEma.store(ema, std::memory_order_relaxed);
+
+    const float pressure = std::clamp((ema - kPressureStart * budget) / (kPressureSpan * budget), 0.0f, 1.0f);
+    s_pressure.store(pressure, std::memory_order_relaxed);
+    TelemetrySet(TelemetryBlock().frameTimeUs, static_cast<std::uint32_t>(ema * 1000.0f));
+    TelemetrySet(TelemetryBlock().framePressurePct, static_cast<std::uint32_t>(pressure * 100.0f));
+}
+
+void OnHiggsFrame() {
+    const long long now = NowUs();
+    if (s_lastHiggsFrameUs != 0) AddFrameSample(static_cast<float>(now - s_lastHiggsFrameUs) / 1000.0f);
+    s_lastHiggsFrameUs = now;
+}
+
+void CloseBatch() {
+    if (s_batchUs == 0) return;
+    s_batches.fetch_add(1, std::memory_order_relaxed);
+    s_batchUsTotal.fetch_add(s_batchUs, std::memory_order_relaxed);
+    s_batchHist.Add(s_batchUs);
+    s_batchUs = 0;
+}
+
+void RecordExecution(TaskType type, long long postUs, long long startUs, long long endUs) {
+    const auto queueUs = static_cast<std::uint32_t>(std::max(0LL, startUs - postUs));
+    const auto execUs = static_cast<std::uint32_t>(std::max(0LL, endUs - startUs));
+
+    auto& st = s_stats[static_cast<std::size_t>(type)];
+    st.total.fetch_add(1, std::memory_order_relaxed);
+    st.execUsTotal.fetch_add(execUs, std::memory_order_relaxed);
+    st.queue.Add(queueUs);
+    st.exec.Add(execUs);
+
+    if (s_lastTaskEndUs == 0 || startUs - s_lastTaskEndUs > kBatchGapUs) {
+        CloseBatch();
+        // Without HIGGS, the spacing of drain batches stands in for frame time
+        if (!s_higgsFrameClock.load(std::memory_order_relaxed) && s_batchStartUs != 0) {
+            AddFrameSample(static_cast<float>(startUs - s_batchStartUs) / 1000.0f);
+        }
+        s_batchStartUs = startUs;
+    }
+    s_batchUs += execUs;
+    s_lastTaskEndUs = endUs;
+
+    const std::uint64_t w = s_ringWrites.load(std::memory_order_relaxed);
+    s_ring[w % kRingSize] = TaskRecord{ type, queueUs, execUs, startUs / 1000 };
+    s_ringWrites.store(w + 1, std::memory_order_release);
+}
+
+// ============================================================================
+// Slab
+// ============================================================================
+
+struct TaskSlab {
+    std::array<TaskSlot, kTaskSlabSize> slots;
+    std::mutex mutex;
+    TaskSlot* free = nullptr;
+    std::uint32_t inUse = 0;
+    std::uint32_t peakInUse = 0;
+
+    TaskSlab() {
+        for (auto it = slots.rbegin(); it != slots.rend(); ++it) {
+            it->next = free;
+            free = &*it;
+        }
+    }
+};
+
+TaskSlab s_slab;
+std::atomic<std::uint64_t> s_heapTasks{ 0 };
+
+// ============================================================================
+// Deferred queue
+// ============================================================================
+
+// Intrusive FIFO through TaskSlot::next; guarded by s_deferredMutex
+std::mutex s_deferredMutex;
+TaskSlot* s_deferredHead = nullptr;
+TaskSlot* s_deferredTail = nullptr;
+std::size_t s_deferredCount = 0;
+std::array<std::uint32_t, kTaskTypeCount> s_deferredPerType{};
+std::atomic<bool> s_drainPending{ false };
+
+// Returns true if the task was queued for later
+bool TryDefer(TaskSlot* slot) {
+    const TaskPriority prio = TaskPriorityOf(slot->type);
+    if (prio == TaskPriority::Critical) return false;
+
+    std::lock_guard<std::mutex> lock(s_deferredMutex);
+    // Keep per-type order (e.g. scale tween steps) once anything of this type is waiting
+    bool defer = s_deferredPerType[static_cast<std::size_t>(slot->type)] > 0;
+    if (!defer) {
+        const float pressure = s_pressure.load(std::memory_order_relaxed);
+        defer = prio == TaskPriority::Normal ? pressure >= kNormalDeferPressure : !AdmitCosmetic();
+    }
+    if (!defer || s_deferredCount >= kMaxDeferredTasks) return false;
+
+    slot->next = nullptr;
+    if (s_deferredTail) s_deferredTail->next = slot;
+    else s_deferredHead = slot;
+    s_deferredTail = slot;
+    ++s_deferredCount;
+    ++s_deferredPerType[static_cast<std::size_t>(slot->type)];
+    TelemetryAdd(TelemetryBlock().tasksDeferred);
+    return true;
+}
+
+// Main thread: release part of the deferred queue, more as pressure falls
+void DrainDeferred() {
+    s_drainPending.store(false);
+    const float pressure = s_pressure.load(std::memory_order_relaxed);
+    const int allowance = std::max(1, static_cast<int>(std::lround(kMaxDeferredPerDrain * (1.0f - pressure))));
+
+    for (int i = 0; i < allowance; ++i) {
+        TaskSlot* slot = nullptr;
+        {
+            std::lock_guard<std::mutex> lock(s_deferredMutex);
+            if (!s_deferredHead) break;
+            slot = s_deferredHead;
+            s_deferredHead = slot->next;
+            if (!s_deferredHead) s_deferredTail = nullptr;
+            --s_deferredCount;
+            --s_deferredPerType[static_cast<std::size_t>(slot->type)];
+        }
+        slot->Run();
+        slot->Dispose();
+    }
+}
+
+// Static delegate for the drain; s_drainPending keeps at most one in SKSE's queue
+class DrainTask final : public SKSE::TaskDelegate {
+public:
+    void Run() override { DrainDeferred(); }
+    void Dispose() override {}
+};
+
+DrainTask s_drainTask;
+
+}  // namespace
+
+// ============================================================================
+// Task slots
+// ============================================================================
+
+void TaskSlot::Run() {
+    const long long startUs = NowUs();
+    _invoke(_storage);
+    RecordExecution(type, postUs, startUs, NowUs());
+}
+
+void TaskSlot::Dispose() {
+    _destroy(_storage);
+    _invoke = nullptr;
+    _destroy = nullptr;
+    if (heap) {
+        delete this;
+        return;
+    }
+    std::lock_guard<std::mutex> lock(s_slab.mutex);
+    next = s_slab.free;
+    s_slab.free = this;
+    --s_slab.inUse;
+}
+
+TaskSlabStats GetTaskSlabStats() {
+    TaskSlabStats st;
+    st.capacity = static_cast<std::uint32_t>(kTaskSlabSize);
+    st.heapAllocations = s_heapTasks.load(std::memory_order_relaxed);
+    std::lock_guard<std::mutex> lock(s_slab.mutex);
+    st.inUse = s_slab.inUse;
+    st.peakInUse = s_slab.peakInUse;
+    return st;
+}
+
+namespace detail {
+
+TaskSlot* AcquireTaskSlot() {
+    {
+        std::lock_guard<std::mutex> lock(s_slab.mutex);
+        if (TaskSlot* slot = s_slab.free) {
+            s_slab.free = slot->next;
+            slot->next = nullptr;
+            slot->heap = false;
+            s_slab.peakInUse = std::max(s_slab.peakInUse, ++s_slab.inUse);
+            return slot;
+        }
+    }
+    // Slab exhausted (main thread stalled, e.g. a long load): fall back to the heap and count it
+    s_heapTasks.fetch_add(1, std::memory_order_relaxed);
+    auto* slot = new TaskSlot();
+    slot->heap = true;
+    return slot;
+}
+
+bool TaskInterfaceReady() {
+    return SKSE::GetTaskInterface() != nullptr;
+}
+
+bool SubmitTaskSlot(TaskType type, TaskSlot* slot) {
+    slot->type = type;
+    slot->postUs = NowUs();
+    TelemetryAdd(TelemetryBlock().tasksPosted);
+    if (cfgDispatcherEnabled && TryDefer(slot)) return true;
+    SKSE::GetTaskInterface()->AddTask(slot);
+    return true;
+}
+
+}  // namespace detail
+
+// ============================================================================
+// Task types
+// ============================================================================
+
+const char* TaskTypeName(TaskType type) {
+    switch (type) {
+        case TaskType::ModStart: return "ModStart";
+        case TaskType::RippleFlush: return "RippleFlush";
+        case TaskType::EntrySplash: return "EntrySplash";
+        case TaskType::ExitSplash: return "ExitSplash";
+        case TaskType::FingertipRipple: return "FingertipRipple";
+        case TaskType::FootSplash: return "FootSplash";
+        case TaskType::StrokeSplash: return "StrokeSplash";
+        case TaskType::ActorUpdate: return "ActorUpdate";
+        case TaskType::ProjectileScan: return "ProjectileScan";
+        case TaskType::SetAngle: return "SetAngle";
+        case TaskType::MoveTo: return "MoveTo";
+        case TaskType::Delete: return "Delete";
+        case TaskType::RefSpawn: return "RefSpawn";
+        case TaskType::ScaleStep: return "ScaleStep";
+        case TaskType::Unequip: return "Unequip";
+        case TaskType::ShockCast: return "ShockCast";
+        case TaskType::ShockStop: return "ShockStop";
+        case TaskType::SoundPreload: return "SoundPreload";
+        default: return "?";
+    }
+}
+
+TaskPriority TaskPriorityOf(TaskType type) {
+    switch (type) {
+        case TaskType::ModStart:
+        case TaskType::RippleFlush:
+        case TaskType::EntrySplash:
+        case TaskType::ExitSplash:
+        case TaskType::Delete:
+        case TaskType::Unequip:
+        case TaskType::ShockCast:
+        case TaskType::ShockStop:
+            return TaskPriority::Critical;
+        case TaskType::ScaleStep:
+            return TaskPriority::Cosmetic;
+        default:
+            return TaskPriority::Normal;
+    }
+}
+
+// ============================================================================
+// Posting
+// ============================================================================
+
+void PumpDeferredTasks() {
+    {
+        std::lock_guard<std::mutex> lock(s_deferredMutex);
+        if (!s_deferredHead) return;
+    }
+    if (s_drainPending.exchange(true)) return;
+    auto taskIntf = SKSE::GetTaskInterface();
+    if (!taskIntf) {
+        s_drainPending.store(false);
+        return;
+    }
+    taskIntf->AddTask(&s_drainTask);
+}
+
+std::size_t ResetDeferredTasks() {
+    TaskSlot* head = nullptr;
+    std::size_t dropped = 0;
+    {
+        std::lock_guard<std::mutex> lock(s_deferredMutex);
+        head = s_deferredHead;
+        dropped = s_deferredCount;
+        s_deferredHead = nullptr;
+        s_deferredTail = nullptr;
+        s_deferredCount = 0;
+        s_deferredPerType.fill(0);
+    }
+    // A drain task already in SKSE's queue finds the queue empty and returns
+    while (head) {
+        TaskSlot* slot = head;
+        head = slot->next;
+        if (slot->onDrop) slot->onDrop();
+        slot->Dispose();
+    }
+    if (dropped > 0) IW_LOG_INFO("ResetDeferredTasks: dropped %zu deferred tasks", dropped);
+    return dropped;
+}
+
+// ============================================================================
+// Frame pressure
+// ============================================================================
+
+void RegisterFrameClock() {
+    auto higgs = HiggsPluginAPI::g_higgsInterface;
+    if (!higgs) return;
+    higgs->AddPostVrikPostHiggsCallback(OnHiggsFrame);
+    s_higgsFrameClock.store(true);
+    IW_LOG_INFO("RegisterFrameClock: using the HIGGS per-frame callback for frame time");
+}
+
+float GetFramePressure() {
+    return cfgDispatcherEnabled ? s_pressure.load(std::memory_order_relaxed) : 0.0f;
+}
+
+bool AdmitCosmetic() {
+    const float admit = 1.0f - GetFramePressure();
+    if (admit >= 1.0f) return true;
+    // Admit when the running count of admitted calls steps up: an evenly spread (1 - pressure) share
+    const std::uint32_t n = s_cosmeticCalls.fetch_add(1, std::memory_order_relaxed);
+    const bool ok = std::floor((n + 1) * admit) > std::floor(n * admit);
+    if (!ok) TelemetryAdd(TelemetryBlock().cosmeticThinned);
+    return ok;
+}
+
+// ============================================================================
+// Reporting
+// ============================================================================
+
+std::vector<TaskRecord> CopyRecentTasks(std::size_t maxRecords) {
+    const std::uint64_t writes = s_ringWrites.load(std::memory_order_acquire);
+    const std::size_t n = static_cast<std::size_t>(std::min<std::uint64_t>({ writes, kRingSize, maxRecords }));
+    std::vector<TaskRecord> out;
+    out.reserve(n);
+    for (std::uint64_t i = writes - n; i < writes; ++i) {
+        out.push_back(s_ring[i % kRingSize]);
+    }
+    return out;
+}
+
+void LogTaskStats() {
+    std::vector<std::string> lines;
+    char buf[256];
+    for (std::size_t t = 0; t < kTaskTypeCount; ++t) {
+        auto& st = s_stats[t];
+        const auto q = st.queue.TakeSummary();
+        const auto e = st.exec.TakeSummary();
+        if (e.count == 0) continue;
+        std::snprintf(buf, sizeof(buf), "  %-18s n=%u queue p50/p95/max=%u/%u/%u us exec p50/p95/max=%u/%u/%u us total=%llu",
+            TaskTypeName(static_cast<TaskType>(t)), e.count, q.p50, q.p95, q.max, e.p50, e.p95, e.max,
+            static_cast<unsigned long long>(st.total.load(std::memory_order_relaxed)));
+        lines.emplace_back(buf);
+    }
+    if (lines.empty()) return;
+
+    const std::uint64_t batches = s_batches.load(std::memory_order_relaxed);
+    const std::uint64_t batchUs = s_batchUsTotal.load(std::memory_order_relaxed);
+    const std::uint64_t dBatches = batches - s_lastLoggedBatches;
+    const std::uint64_t dUs = batchUs - s_lastLoggedBatchUs;
+    s_lastLoggedBatches = batches;
+    s_lastLoggedBatchUs = batchUs;
+    const auto frame = s_batchHist.TakeSummary();
+    std::size_t deferred = 0;
+    {
+        std::lock_guard<std::mutex> lock(s_deferredMutex);
+        deferred = s_deferredCount;
+    }
+    std::snprintf(buf, sizeof(buf), "Main-thread tasks: %llu frames with work, avg %.1f us/frame, p95 %u us, max %u us; frame %.2f ms, pressure %.2f, deferred %zu",
+        static_cast<unsigned long long>(dBatches), dBatches ? static_cast<double>(dUs) / static_cast<double>(dBatches) : 0.0,
+        frame.p95, frame.max, s_frameMsEma.load(std::memory_order_relaxed), GetFramePressure(), deferred);
+    lines.insert(lines.begin(), buf);
+    const TaskSlabStats slab = GetTaskSlabStats();
+    std::snprintf(buf, sizeof(buf), "  task slab: %u/%u in use, peak %u, heap allocations %llu",
+        slab.inUse, slab.capacity, slab.peakInUse, static_cast<unsigned long long>(slab.heapAllocations));
+    lines.insert(lines.begin() + 1, buf);
+    AppendLinesToPluginLog("INFO", lines);
+}
+
+} // namespace InteractiveWaterVR
@@ -0,0 +1,168 @@
+#pragma once
+// main_thread_tasks.h - Typed, timed main-thread task posting
+
+#include <SKSE/SKSE.h>
+#include <cstddef>
+#include <cstdint>
+#include <new>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace InteractiveWaterVR {
+
+// ============================================================================
+// Task types
+// ============================================================================
+
+enum class TaskType : std::uint8_t {
+    ModStart = 0,
+    RippleFlush,
+    EntrySplash,
+    ExitSplash,
+    FingertipRipple,
+    FootSplash,
+    StrokeSplash,
+    ActorUpdate,
+    ProjectileScan,
+    SetAngle,
+    MoveTo,
+    Delete,
+    RefSpawn,
+    ScaleStep,
+    Unequip,
+    ShockCast,
+    ShockStop,
+    SoundPreload,
+    Count
+};
+
+constexpr std::size_t kTaskTypeCount = static_cast<std::size_t>(TaskType::Count);
+
+const char* TaskTypeName(TaskType type);
+
+// ============================================================================
+// Priority classes
+// ============================================================================
+
+// Critical work always runs on the next frame. When recent frames run over budget, normal work is
+// deferred and cosmetic work is thinned/deferred, then released gradually as frame time recovers.
+enum class TaskPriority : std::uint8_t {
+    Critical = 0,   // entry/exit splashes, state changes (unequip, shock), cleanup
+    Normal,         // sounds, spawns/moves, secondary sources
+    Cosmetic        // wakes, scale tweens
+};
+
+TaskPriority TaskPriorityOf(TaskType type);
+
+// ============================================================================
+// Task slab
+// ============================================================================
+
+// Capture storage per task; the largest task the mod posts captures ~40 bytes
+constexpr std::size_t kTaskStorageBytes = 64;
+
+// One posted task: the callable lives inline, the object comes from a preallocated slab (or the
+// heap, counted, once the slab is exhausted) and goes back to it in Dispose
+class TaskSlot final : public SKSE::TaskDelegate {
+public:
+    void Run() override;
+    void Dispose() override;
+
+    template <class F>
+    void Emplace(F&& fn) {
+        using Fn = std::decay_t<F>;
+        ::new (static_cast<void*>(_storage)) Fn(std::forward<F>(fn));
+        _invoke = [](void* p) { (*static_cast<Fn*>(p))(); };
+        _destroy = [](void* p) { static_cast<Fn*>(p)->~Fn(); };
+    }
+
+    TaskType type = TaskType::Count;
+    long long postUs = 0;
+    bool heap = false;
+    void (*onDrop)() = nullptr;  // called instead of the task when a reset drops it unrun
+    TaskSlot* next = nullptr;  // free list / deferred queue link
+
+private:
+    alignas(std::max_align_t) unsigned char _storage[kTaskStorageBytes];
+    void (*_invoke)(void*) = nullptr;
+    void (*_destroy)(void*) = nullptr;
+};
+
+struct TaskSlabStats {
+    std::uint32_t capacity = 0;
+    std::uint32_t inUse = 0;
+    std::uint32_t peakInUse = 0;
+    std::uint64_t heapAllocations = 0;  // tasks that did not fit in the slab (should stay 0)
+};
+
+TaskSlabStats GetTaskSlabStats();
+
+namespace detail {
+TaskSlot* AcquireTaskSlot();
+bool SubmitTaskSlot(TaskType type, TaskSlot* slot);
+bool TaskInterfaceReady();
+}
+
+// ============================================================================
+// Posting
+// ============================================================================
+
+// AddTask replacement: the callable is stored inline in a slab task (no std::function, no heap in
+// steady state), the task is tagged, its queue delay (post -> run) and execution time are recorded
+// on the main thread, and it is deferred under frame pressure according to its priority class.
+// Returns false (and does not run fn) if the task interface is unavailable.
+// Coalescing posters pass onDrop to clear their pending flag if a session reset drops the task
+// from the deferred queue without running it.
+template <class F>
+bool PostTask(TaskType type, F&& fn, void (*onDrop)() = nullptr) {
+    using Fn = std::decay_t<F>;
+    static_assert(sizeof(Fn) <= kTaskStorageBytes, "task capture does not fit in a slab task");
+    static_assert(alignof(Fn) <= alignof(std::max_align_t), "task capture is over-aligned");
+    if (!detail::TaskInterfaceReady()) return false;
+    TaskSlot* slot = detail::AcquireTaskSlot();
+    slot->Emplace(std::forward<F>(fn));
+    slot->onDrop = onDrop;
+    return detail::SubmitTaskSlot(type, slot);
+}
+
+// Monitoring thread: post one drain task for deferred work if any is waiting
+void PumpDeferredTasks();
+
+// Session reset: drop deferred work without running it (it targets the previous session), call
+// each dropped task's onDrop and return its slab tasks. Returns the number of tasks dropped.
+std::size_t ResetDeferredTasks();
+
+// ============================================================================
+// Frame pressure
+// ============================================================================
+
+// Use the HIGGS per-frame callback as the frame clock (otherwise task drain intervals are used)
+void RegisterFrameClock();
+
+// 0 = frames comfortably within budget, 1 = frames at or beyond budget + 30%
+float GetFramePressure();
+
+// Thread-safe thinning for cosmetic work done outside PostTask (wake ripples/sounds): admits
+// a (1 - pressure) fraction of calls, evenly spread
+bool AdmitCosmetic();
+
+// ============================================================================
+// Reporting
+// ============================================================================
+
+struct TaskRecord {
+    TaskType type = TaskType::Count;
+    std::uint32_t queueUs = 0;
+    std::uint32_t execUs = 0;
+    long long startMs = 0;  // steady-clock ms when the task started running
+};
+
+// Most recent task executions, oldest first (at most maxRecords)
+std::vector<TaskRecord> CopyRecentTasks(std::size_t maxRecords);
+
+// Per-type counts, p50/p95/max queue delay and execution time, and main-thread cost per drained
+// frame since the previous call; logs only types that ran
+void LogTaskStats();
+
+} // namespace InteractiveWaterVR
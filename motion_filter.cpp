@@ -0,0 +1,124 @@
+// motion_filter.cpp - Adaptive filtering of tracked probe motion (One-Euro filter)
+
+#include "motion_filter.h"
+#include <cmath>
+#include <algorithm>
+
+namespace InteractiveWaterVR {
+
+namespace {
+
+constexpr float kTwoPi = 6.28318530718f;
+
+// Smoothing factor of a first-order low-pass at the given cutoff for a step of dt seconds
+inline float LowPassAlpha(float cutoffHz, float dt) {
+    const float tau = 1.0f / (kTwoPi * std::max(cutoffHz, 1e-3f));
+    return 1.0f / (1.0f + tau / dt);
+}
+
+inline float Lerp(float a, float b, float t) {
+    return a + (b - a) * t;
+}
+
+// 0.2 at the jitter level, 0.5 at twice that, approaching 1 for clearly deliberate motion
+inline float MotionConfidence(float speedSq, const MotionFilterParams& params) {
+    const float noise = 2.0f * std::max(params.jitterSpeed, 1e-4f);
+    return speedSq / (speedSq + noise * noise);
+}
+
+} // namespace
+
+// ============================================================================
+// One-Euro filter
+// ============================================================================
+
+void MotionFilter::Reset() {
+    _state = MotionState{};
+    _hasSample = false;
+}
+
+const MotionState& MotionFilter::Update(float x, float y, float z, float dt, const MotionFilterParams& params) {
+    if (!_hasSample || dt <= 1e-6f) {
+        if (!_hasSample) {
+            _state = MotionState{};
+            _state.pos = {x, y, z};
+            _hasSample = true;
+        }
+        return _state;
+    }
+
+    // Raw derivative against the previous filtered position
+    const float dx = (x - _state.pos.x) / dt;
+    const float dy = (y - _state.pos.y) / dt;
+    const float dz = (z - _state.pos.z) / dt;
+    const float rawSpeedSq = dx * dx + dy * dy + dz * dz;
+
+    // Tracking jump (teleport, controller reacquired): re-seed instead of smearing the jump into velocity
+    if (rawSpeedSq > params.teleportSpeed * params.teleportSpeed) {
+        _state = MotionState{};
+        _state.pos = {x, y, z};
+        return _state;
+    }
+
+    const float aD = LowPassAlpha(params.derivCutoffHz, dt);
+    _state.vel.x = Lerp(_state.vel.x, dx, aD);
+    _state.vel.y = Lerp(_state.vel.y, dy, aD);
+    _state.vel.z = Lerp(_state.vel.z, dz, aD);
+    const float speedSq = _state.vel.x * _state.vel.x + _state.vel.y * _state.vel.y + _state.vel.z * _state.vel.z;
+    _state.speed = std::sqrt(speedSq);
+
+    // Speed-adaptive cutoff: heavy smoothing at rest, little lag during real motion
+    const float aP = LowPassAlpha(params.minCutoffHz + params.beta * _state.speed, dt);
+    _state.pos.x = Lerp(_state.pos.x, x, aP);
+    _state.pos.y = Lerp(_state.pos.y, y, aP);
+    _state.pos.z = Lerp(_state.pos.z, z, aP);
+
+    _state.confidence = MotionConfidence(speedSq, params);
+    _state.valid = true;
+    return _state;
+}
+
+MotionState WithMeasuredVelocity(const MotionState& base, float vx, float vy, float vz, const MotionFilterParams& params) {
+    MotionState out = base;
+    out.vel = {vx, vy, vz};
+    const float speedSq = vx * vx + vy * vy + vz * vz;
+    out.speed = std::sqrt(speedSq);
+    out.confidence = MotionConfidence(speedSq, params);
+    out.valid = true;
+    return out;
+}
+
+// ============================================================================
+// Moving / stationary decision
+// ============================================================================
+
+void MovementDetector::Reset() {
+    _moving = false;
+    _aboveSeconds = 0.0f;
+    _belowSeconds = 0.0f;
+}
+
+bool MovementDetector::Update(const MotionState& state, float dt, float movingThreshold, float confirmSeconds, float stationarySeconds) {
+    if (!state.valid || dt <= 0.0f) {
+        return _moving;
+    }
+
+    // Motion only counts when it is both above threshold and distinguishable from jitter
+    const bool above = state.speed > movingThreshold && state.confidence >= 0.5f;
+    if (above) {
+        _aboveSeconds += dt;
+        _belowSeconds = 0.0f;
+        if (!_moving && _aboveSeconds >= confirmSeconds) {
+            _moving = true;
+        }
+    } else {
+        _belowSeconds += dt;
+        _aboveSeconds = 0.0f;
+        if (_moving && _belowSeconds >= stationarySeconds) {
+            _moving = false;
+        }
+    }
+    return _moving;
+}
+
+} // namespace InteractiveWaterVR
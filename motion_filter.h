@@ -0,0 +1,79 @@
+#pragma once
+// motion_filter.h - Adaptive filtering of tracked probe motion (One-Euro filter)
+//
+// Engine independent: works on plain floats so the same code can run outside the game.
+
+namespace InteractiveWaterVR {
+
+// ============================================================================
+// Filter parameters
+// ============================================================================
+
+struct MotionFilterParams {
+    float minCutoffHz;    // position cutoff at rest (lower = more jitter rejection)
+    float beta;           // cutoff increase per unit/s of speed (higher = less lag on fast motion)
+    float derivCutoffHz;  // cutoff used for the velocity estimate
+    float jitterSpeed;    // filtered speeds around this level are treated as tracking noise
+    float teleportSpeed;  // raw speeds above this are tracking jumps and re-seed the filter
+};
+
+// ============================================================================
+// Filtered state (one per probe, updated every tick)
+// ============================================================================
+
+struct MotionVec3 {
+    float x = 0.0f;
+    float y = 0.0f;
+    float z = 0.0f;
+};
+
+struct MotionState {
+    MotionVec3 pos;            // filtered position
+    MotionVec3 vel;            // filtered velocity (units/s)
+    float speed = 0.0f;        // |vel|
+    float confidence = 0.0f;   // 0 = indistinguishable from jitter, 1 = clearly real motion
+    bool valid = false;        // false until the filter has seen two samples
+};
+
+// ============================================================================
+// One-Euro filter
+// ============================================================================
+
+class MotionFilter {
+public:
+    void Reset();
+
+    // Feed one raw sample taken dt seconds after the previous one
+    const MotionState& Update(float x, float y, float z, float dt, const MotionFilterParams& params);
+
+    const MotionState& State() const { return _state; }
+    bool HasSample() const { return _hasSample; }
+
+private:
+    MotionState _state;
+    bool _hasSample = false;
+};
+
+// Replace the differenced velocity with a direct measurement (e.g. a physics body) while keeping the
+// filtered position; speed and confidence are recomputed from the measured velocity.
+MotionState WithMeasuredVelocity(const MotionState& base, float vx, float vy, float vz, const MotionFilterParams& params);
+
+// ============================================================================
+// Moving / stationary decision
+// ============================================================================
+
+// Hysteresis on top of the filtered state: moving once the filtered speed has stayed above the moving
+// threshold for confirmSeconds, stationary again once it has stayed below it for stationarySeconds.
+class MovementDetector {
+public:
+    void Reset();
+    bool Update(const MotionState& state, float dt, float movingThreshold, float confirmSeconds, float stationarySeconds);
+    bool IsMoving() const { return _moving; }
+
+private:
+    bool _moving = false;
+    float _aboveSeconds = 0.0f;
+    float _belowSeconds = 0.0f;
+};
+
+} // namespace InteractiveWaterVR
@@ -0,0 +1,141 @@
+#pragma once
+// periodic_schedule.h - Absolute-deadline periodic timing, spin-then-sleep waits, period jitter
+
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+
+namespace InteractiveWaterVR {
+
+// Everything here is templated on the clock and never sleeps by itself, so the scheduling maths and
+// the wait strategy can be driven by a fake clock (a type with a static now() and the usual
+// duration/time_point typedefs).
+
+// ============================================================================
+// Deadline
+// ============================================================================
+
+// Deadlines of one periodic job on a fixed grid: the next deadline is the previous deadline plus
+// the period, not "now + period", so work time and oversleep do not accumulate into drift. When a
+// run overran whole periods, those slots are skipped (not replayed in a burst) and the grid phase
+// is kept.
+template <class Clock>
+class PeriodicDeadline {
+public:
+    using time_point = typename Clock::time_point;
+    using duration = typename Clock::duration;
+
+    void Start(time_point first) { _due = first; }
+    time_point Due() const { return _due; }
+
+    // Advance past the deadline just served; `now` is when the run finished. Returns the number of
+    // skipped slots (0 when the run fit within the period).
+    std::uint32_t Advance(time_point now, duration period) {
+        if (period <= duration::zero()) {
+            _due = now;
+            return 0;
+        }
+        _due += period;
+        if (_due > now) return 0;
+        const auto behind = (now - _due) / period + 1;
+        _due += period * behind;
+        return static_cast<std::uint32_t>(behind);
+    }
+
+private:
+    time_point _due{};
+};
+
+// ============================================================================
+// Spin-then-sleep wait
+// ============================================================================
+
+// OS sleeps overshoot by up to a timer tick, so sleep until `spin` before the deadline and spin on
+// the clock for the rest. sleepUntil(tp) may return early (returns false when it was woken for
+// another reason, e.g. new work); relax() is called once per spin iteration (a pause/yield).
+// Returns true once `due` is reached, false if sleepUntil was interrupted first.
+template <class Clock, class SleepUntil, class Relax>
+bool WaitUntilPrecise(typename Clock::time_point due, typename Clock::duration spin, SleepUntil&& sleepUntil,
+                      Relax&& relax) {
+    auto now = Clock::now();
+    if (due - now > spin) {
+        if (!sleepUntil(due - spin)) return false;
+        now = Clock::now();
+    }
+    while (now < due) {
+        relax();
+        now = Clock::now();
+    }
+    return true;
+}
+
+// ============================================================================
+// Period jitter
+// ============================================================================
+
+// Start-to-start periods of one job against the nominal period it asked for. Deviations go into
+// 50 us linear buckets (the interesting range is well under a few ms), the tail into the last one.
+class PeriodJitter {
+public:
+    static constexpr std::uint32_t kBucketUs = 50;
+    static constexpr std::size_t kBuckets = 64;
+
+    struct Summary {
+        std::uint32_t count = 0;
+        double meanPeriodUs = 0.0;
+        double meanNominalUs = 0.0;
+        std::uint32_t p50DevUs = 0;   // |actual - nominal|, bucket upper bound
+        std::uint32_t p95DevUs = 0;
+        std::uint32_t maxDevUs = 0;
+        std::uint32_t skipped = 0;    // slots dropped after overruns
+    };
+
+    void Add(long long actualUs, long long nominalUs) {
+        const auto dev = static_cast<std::uint32_t>(std::min<long long>(std::llabs(actualUs - nominalUs), UINT32_MAX));
+        ++_buckets[std::min<std::size_t>(dev / kBucketUs, kBuckets - 1)];
+        ++_count;
+        _periodUs += static_cast<std::uint64_t>(std::max(0ll, actualUs));
+        _nominalUs += static_cast<std::uint64_t>(std::max(0ll, nominalUs));
+        _maxDevUs = std::max(_maxDevUs, dev);
+    }
+
+    void AddSkipped(std::uint32_t slots) { _skipped += slots; }
+
+    // Summary of the window so far; clears it
+    Summary Take() {
+        Summary s;
+        s.count = _count;
+        s.maxDevUs = _maxDevUs;
+        s.skipped = _skipped;
+        if (_count > 0) {
+            s.meanPeriodUs = static_cast<double>(_periodUs) / _count;
+            s.meanNominalUs = static_cast<double>(_nominalUs) / _count;
+            auto percentile = [&](double p) {
+                const auto target = std::max<std::uint32_t>(static_cast<std::uint32_t>(p * _count + 0.5), 1);
+                std::uint32_t seen = 0;
+                for (std::size_t i = 0; i < kBuckets; ++i) {
+                    seen += _buckets[i];
+                    if (seen >= target) return std::min(static_cast<std::uint32_t>((i + 1) * kBucketUs), _maxDevUs);
+                }
+                return _maxDevUs;
+            };
+            s.p50DevUs = percentile(0.50);
+            s.p95DevUs = percentile(0.95);
+        }
+        *this = PeriodJitter{};
+        return s;
+    }
+
+private:
+    std::array<std::uint32_t, kBuckets> _buckets{};
+    std::uint32_t _count = 0;
+    std::uint64_t _periodUs = 0;
+    std::uint64_t _nominalUs = 0;
+    std::uint32_t _maxDevUs = 0;
+    std::uint32_t _skipped = 0;
+};
+
+} // namespace InteractiveWaterVR
@@ -0,0 +1,112 @@
+// ref_spawn.cpp - Single-step reference spawning on the main thread
+
+#include "ref_spawn.h"
+#include "water_state.h"
+#include "main_thread_tasks.h"
+#include "telemetry.h"
+#include "helper.h"
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <mutex>
+
+namespace InteractiveWaterVR {
+
+// ============================================================================
+// Queue
+// ============================================================================
+
+namespace {
+
+// A frame rarely needs more than one spawn per hand; this bounds a burst, not the steady state
+constexpr std::size_t kMaxQueuedSpawns = 16;
+
+std::mutex s_spawnMutex;
+std::array<SpawnSpec, kMaxQueuedSpawns> s_queued{};
+std::size_t s_queuedCount = 0;
+std::atomic<bool> s_flushPending{ false };
+std::atomic<std::uint64_t> s_spawnsDropped{ 0 };
+
+// Main thread: place everything queued so far as one batch
+void FlushSpawnQueue() {
+    s_flushPending.store(false);
+
+    std::array<SpawnSpec, kMaxQueuedSpawns> batch;
+    std::size_t count = 0;
+    {
+        std::lock_guard<std::mutex> lock(s_spawnMutex);
+        count = s_queuedCount;
+        std::copy_n(s_queued.begin(), count, batch.begin());
+        s_queuedCount = 0;
+    }
+    if (g_gameLoadInProgress.load()) return;
+
+    for (std::size_t i = 0; i < count; ++i) {
+        const SpawnSpec& spec = batch[i];
+        RE::NiPointer<RE::TESObjectREFR> ref;
+        try {
+            ref = SpawnReferenceNow(spec);
+        } catch (...) {
+            IW_LOG_WARN("FlushSpawnQueue: exception while spawning");
+        }
+        if (spec.onSpawned) spec.onSpawned(ref, spec.tag);
+    }
+}
+
+}  // namespace
+
+// ============================================================================
+// Spawning
+// ============================================================================
+
+RE::NiPointer<RE::TESObjectREFR> SpawnReferenceNow(const SpawnSpec& spec) {
+    auto player = RE::PlayerCharacter::GetSingleton();
+    if (!player || !spec.form) return {};
+
+    auto ref = player->PlaceObjectAtMe(spec.form, false);
+    if (!ref) {
+        IW_LOG_WARN("SpawnReferenceNow: PlaceObjectAtMe failed for form 0x%08X", spec.form->GetFormID());
+        return {};
+    }
+
+    // Scale and rotation first, then one move: SetPosition moves the reference and any loaded 3D
+    // to the final position with data.angle applied, all before the next render
+    if (spec.scale != 1.0f) ref->SetScale(spec.scale);
+    ref->data.angle = spec.angle;
+    ref->SetPosition(spec.position);
+    return ref;
+}
+
+bool QueueSpawn(const SpawnSpec& spec) {
+    if (!spec.form) return false;
+    {
+        std::lock_guard<std::mutex> lock(s_spawnMutex);
+        if (s_queuedCount >= kMaxQueuedSpawns) {
+            const auto dropped = s_spawnsDropped.fetch_add(1) + 1;
+            IW_LOG_WARN("QueueSpawn: spawn queue full - dropping request (%llu dropped so far)",
+                static_cast<unsigned long long>(dropped));
+            return false;
+        }
+        s_queued[s_queuedCount++] = spec;
+    }
+
+    if (s_flushPending.exchange(true)) {
+        TelemetryAdd(TelemetryBlock().tasksCoalesced);
+        return true;
+    }
+    // Dropped by a reset: ResetSpawnQueue empties the queue the flush would have drained
+    if (!PostTask(TaskType::RefSpawn, []() { FlushSpawnQueue(); }, []() { s_flushPending.store(false); })) {
+        s_flushPending.store(false);
+        std::lock_guard<std::mutex> lock(s_spawnMutex);
+        s_queuedCount = 0;
+        return false;
+    }
+    return true;
+}
+
+void ResetSpawnQueue() {
+    std::lock_guard<std::mutex> lock(s_spawnMutex);
+    s_queuedCount = 0;
+}
+
+} // namespace InteractiveWaterVR
@@ -0,0 +1,36 @@
+#pragma once
+// ref_spawn.h - Single-step reference spawning on the main thread
+
+#include <RE/Skyrim.h>
+#include <cstdint>
+
+namespace InteractiveWaterVR {
+
+// ============================================================================
+// Spawn requests
+// ============================================================================
+
+// Final transform of a spawned reference. The reference is placed, moved, rotated and scaled in
+// the same main-thread step, so its first rendered frame is already correct.
+struct SpawnSpec {
+    RE::TESBoundObject* form = nullptr;
+    RE::NiPoint3 position{};
+    RE::NiPoint3 angle{};   // radians
+    float scale = 1.0f;
+    // Main thread, straight after placement; ref is null if placement failed
+    void (*onSpawned)(RE::NiPointer<RE::TESObjectREFR> ref, std::uint32_t tag) = nullptr;
+    std::uint32_t tag = 0;  // passed through to onSpawned (e.g. which hand)
+};
+
+// Main thread: place at the player, then set position, rotation and scale directly (no Papyrus
+// natives, no further tasks). Does not call onSpawned.
+RE::NiPointer<RE::TESObjectREFR> SpawnReferenceNow(const SpawnSpec& spec);
+
+// Any thread: queue a spawn; all spawns queued before the next frame are placed in one task.
+// Returns false if the queue is full or the task interface is unavailable.
+bool QueueSpawn(const SpawnSpec& spec);
+
+// Drop queued spawns (game load / state reset)
+void ResetSpawnQueue();
+
+} // namespace InteractiveWaterVR
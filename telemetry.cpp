@@ -0,0 +1,152 @@
+// telemetry.cpp - Live counters published through a shared-memory block
+
+#include "telemetry.h"
+#include "water_ripple.h"
+#include "water_actor_grid.h"
+#include "water_thrown_objects.h"
+#include "water_projectiles.h"
+#include "helper.h"
+#include "config.h"
+#include <new>
+#include <windows.h>
+
+namespace InteractiveWaterVR {
+
+// ============================================================================
+// Block storage
+// ============================================================================
+
+namespace {
+
+// Used before InitTelemetry and when mapping fails; same layout, just not visible outside the process
+Telemetry::Block s_localBlock{};
+std::atomic<Telemetry::Block*> s_block{ &s_localBlock };
+
+HANDLE s_fileHandle = INVALID_HANDLE_VALUE;
+HANDLE s_mappingHandle = nullptr;
+
+// Peaks accumulate here and are published once per period, so readers always see a whole period's peak
+std::atomic<std::uint32_t> s_stagePeakAccum[Telemetry::kStageCount]{};
+
+std::uint64_t s_lastIterations = 0;
+std::chrono::steady_clock::time_point s_lastPublish{};
+
+long long TelemetryNowMs() {
+    return std::chrono::duration_cast<std::chrono::milliseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+// Everything but the magic, which is written last to mark the block valid
+void WriteHeader(Telemetry::Block* b) {
+    b->version = Telemetry::kVersion;
+    b->size = static_cast<std::uint32_t>(sizeof(Telemetry::Block));
+    b->writerPid = static_cast<std::uint32_t>(GetCurrentProcessId());
+}
+
+}  // namespace
+
+// ============================================================================
+// Setup
+// ============================================================================
+
+void InitTelemetry() {
+    WriteHeader(&s_localBlock);
+    s_localBlock.magic = Telemetry::kMagic;
+    if (!cfgTelemetryEnabled || s_mappingHandle) return;
+
+    constexpr DWORD kSize = static_cast<DWORD>(sizeof(Telemetry::Block));
+    if (!cfgTelemetryFile.empty()) {
+        // File-backed: readable by tools that cannot open a Windows named mapping (e.g. under Proton)
+        s_fileHandle = CreateFileA(cfgTelemetryFile.c_str(), GENERIC_READ | GENERIC_WRITE,
+            FILE_SHARE_READ | FILE_SHARE_WRITE, nullptr, CREATE_ALWAYS, FILE_ATTRIBUTE_NORMAL, nullptr);
+        if (s_fileHandle == INVALID_HANDLE_VALUE) {
+            IW_LOG_WARN("InitTelemetry: could not open '%s' (error %lu) - telemetry stays in-process",
+                cfgTelemetryFile.c_str(), GetLastError());
+            return;
+        }
+        s_mappingHandle = CreateFileMappingA(s_fileHandle, nullptr, PAGE_READWRITE, 0, kSize, nullptr);
+    } else {
+        s_mappingHandle = CreateFileMappingA(INVALID_HANDLE_VALUE, nullptr, PAGE_READWRITE, 0, kSize, Telemetry::kMappingName);
+    }
+    if (!s_mappingHandle) {
+        IW_LOG_WARN("InitTelemetry: CreateFileMapping failed (error %lu) - telemetry stays in-process", GetLastError());
+        return;
+    }
+
+    void* view = MapViewOfFile(s_mappingHandle, FILE_MAP_ALL_ACCESS, 0, 0, kSize);
+    if (!view) {
+        IW_LOG_WARN("InitTelemetry: MapViewOfFile failed (error %lu) - telemetry stays in-process", GetLastError());
+        CloseHandle(s_mappingHandle);
+        s_mappingHandle = nullptr;
+        return;
+    }
+
+    // Zero the block, then write the magic last so a reader never sees a half-initialised block as valid
+    auto* block = new (view) Telemetry::Block{};
+    block->magic = 0;
+    WriteHeader(block);
+    std::atomic_thread_fence(std::memory_order_release);
+    block->magic = Telemetry::kMagic;
+    s_block.store(block, std::memory_order_release);
+
+    IW_LOG_INFO("InitTelemetry: publishing %u-byte telemetry block v%u (%s)", static_cast<unsigned>(kSize),
+        Telemetry::kVersion, cfgTelemetryFile.empty() ? Telemetry::kMappingName : cfgTelemetryFile.c_str());
+}
+
+Telemetry::Block& TelemetryBlock() {
+    return *s_block.load(std::memory_order_relaxed);
+}
+
+// ============================================================================
+// Writers
+// ============================================================================
+
+void TelemetryRecordStage(Telemetry::Stage s, std::uint32_t micros) {
+    auto& b = TelemetryBlock();
+    const auto i = static_cast<std::size_t>(s);
+    b.stageLastUs[i].store(micros, std::memory_order_relaxed);
+    // Benign race with the publisher's reset: at worst one peak sample is lost
+    if (micros > s_stagePeakAccum[i].load(std::memory_order_relaxed)) {
+        s_stagePeakAccum[i].store(micros, std::memory_order_relaxed);
+    }
+}
+
+void PublishTelemetry() {
+    auto& b = TelemetryBlock();
+    const auto now = std::chrono::steady_clock::now();
+
+    const std::uint64_t iterations = b.iterations.load(std::memory_order_relaxed);
+    if (s_lastPublish.time_since_epoch().count() != 0) {
+        const float secs = std::chrono::duration<float>(now - s_lastPublish).count();
+        if (secs > 0.0f) {
+            TelemetrySet(b.iterationsPerSec, static_cast<std::uint32_t>(static_cast<float>(iterations - s_lastIterations) / secs));
+        }
+    }
+    s_lastIterations = iterations;
+    s_lastPublish = now;
+
+    // Module totals are already kept by their owners; mirror them rather than double-counting
+    const RippleCounters rc = GetRippleCounters();
+    b.ripplesQueued.store(rc.queued, std::memory_order_relaxed);
+    b.ripplesMerged.store(rc.merged, std::memory_order_relaxed);
+    b.ripplesDropped.store(rc.dropped, std::memory_order_relaxed);
+    b.ripplesEmitted.store(rc.emitted, std::memory_order_relaxed);
+
+    const ActorWaterStats as = GetActorWaterStats();
+    TelemetrySet(b.actorsTracked, as.tracked);
+    b.actorSplashes.store(as.splashes, std::memory_order_relaxed);
+
+    const ThrownObjectStats ts = GetThrownObjectStats();
+    TelemetrySet(b.thrownObjectsTracked, ts.tracked);
+    b.thrownSplashes.store(ts.splashes, std::memory_order_relaxed);
+
+    const ProjectileWaterStats ps = GetProjectileWaterStats();
+    b.projectileImpacts.store(ps.crossings, std::memory_order_relaxed);
+
+    for (std::size_t i = 0; i < Telemetry::kStageCount; ++i) {
+        TelemetrySet(b.stagePeakUs[i], s_stagePeakAccum[i].exchange(0, std::memory_order_relaxed));
+    }
+    b.heartbeatMs.store(static_cast<std::uint64_t>(TelemetryNowMs()), std::memory_order_relaxed);
+}
+
+} // namespace InteractiveWaterVR
@@ -0,0 +1,56 @@
+#pragma once
+// telemetry.h - Live counters published through a shared-memory block
+
+#include "telemetry_layout.h"
+#include <chrono>
+
+namespace InteractiveWaterVR {
+
+// ============================================================================
+// Setup
+// ============================================================================
+
+// Map the telemetry block ([Telemetry] Enabled / File). Until this succeeds, and whenever it
+// fails, writes go to a process-local block so call sites never need to check.
+void InitTelemetry();
+
+Telemetry::Block& TelemetryBlock();
+
+// ============================================================================
+// Writers (relaxed; safe from any thread)
+// ============================================================================
+
+inline void TelemetryAdd(Telemetry::Counter& c, std::uint64_t n = 1) {
+    c.fetch_add(n, std::memory_order_relaxed);
+}
+
+inline void TelemetrySet(Telemetry::Gauge& g, std::uint32_t v) {
+    g.store(v, std::memory_order_relaxed);
+}
+
+inline void TelemetrySkip(Telemetry::SkipReason r) {
+    TelemetryAdd(TelemetryBlock().skips[static_cast<std::size_t>(r)]);
+}
+
+void TelemetryRecordStage(Telemetry::Stage s, std::uint32_t micros);
+
+// Times the enclosing scope into one stage
+class TelemetryStageTimer {
+public:
+    explicit TelemetryStageTimer(Telemetry::Stage s) : _stage(s), _start(std::chrono::steady_clock::now()) {}
+    ~TelemetryStageTimer() {
+        const auto us = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - _start).count();
+        TelemetryRecordStage(_stage, static_cast<std::uint32_t>(us));
+    }
+    TelemetryStageTimer(const TelemetryStageTimer&) = delete;
+    TelemetryStageTimer& operator=(const TelemetryStageTimer&) = delete;
+
+private:
+    Telemetry::Stage _stage;
+    std::chrono::steady_clock::time_point _start;
+};
+
+// Monitoring thread, about once per second: rates, heartbeat, mirrored module counters, peak reset
+void PublishTelemetry();
+
+} // namespace InteractiveWaterVR
@@ -0,0 +1,138 @@
+#pragma once
+// telemetry_layout.h - Shared-memory telemetry block layout
+//
+// Engine independent: included by the plugin (writer) and tools/telemetry_reader (reader). The
+// layout is fixed and versioned; bump kVersion whenever a field is added, removed or reordered.
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+namespace InteractiveWaterVR {
+namespace Telemetry {
+
+// ============================================================================
+// Identification
+// ============================================================================
+
+constexpr std::uint32_t kMagic = 0x54575649u;  // "IVWT" little-endian
+constexpr std::uint32_t kVersion = 2;
+
+// Named mapping used when no backing file is configured (Windows)
+constexpr const char* kMappingName = "Local\\InteractiveWaterVR_Telemetry";
+
+// ============================================================================
+// Indexed counters
+// ============================================================================
+
+enum class SkipReason : std::uint32_t {
+    NoPlayer = 0,
+    NoRoot,
+    GameLoad,
+    NoNodes,
+    NoWaterType,
+    FastTravel,        // no longer counted (fast travel suspends the monitor); kept so the layout stays at kVersion
+    DeepWater,
+    SneakDepth,
+    Count
+};
+
+enum class Stage : std::uint32_t {
+    Tick = 0,          // one monitor Tick job run on a worker (it never sleeps)
+    HandWater,         // per-hand water queries
+    RippleFlush,       // FlushQueuedRipples on the main thread
+    ActorUpdate,       // UpdateNearbyActorWater on the main thread
+    ProjectileScan,    // ScanProjectilesForWater on the main thread
+    Count
+};
+
+inline const char* SkipReasonName(SkipReason r) {
+    switch (r) {
+        case SkipReason::NoPlayer: return "noPlayer";
+        case SkipReason::NoRoot: return "noRoot";
+        case SkipReason::GameLoad: return "gameLoad";
+        case SkipReason::NoNodes: return "noNodes";
+        case SkipReason::NoWaterType: return "noWaterType";
+        case SkipReason::FastTravel: return "fastTravel";
+        case SkipReason::DeepWater: return "deepWater";
+        case SkipReason::SneakDepth: return "sneakDepth";
+        default: return "?";
+    }
+}
+
+inline const char* StageName(Stage s) {
+    switch (s) {
+        case Stage::Tick: return "tick";
+        case Stage::HandWater: return "handWater";
+        case Stage::RippleFlush: return "rippleFlush";
+        case Stage::ActorUpdate: return "actorUpdate";
+        case Stage::ProjectileScan: return "projectileScan";
+        default: return "?";
+    }
+}
+
+constexpr std::size_t kSkipReasonCount = static_cast<std::size_t>(SkipReason::Count);
+constexpr std::size_t kStageCount = static_cast<std::size_t>(Stage::Count);
+
+// ============================================================================
+// Block
+// ============================================================================
+
+using Counter = std::atomic<std::uint64_t>;
+using Gauge = std::atomic<std::uint32_t>;
+
+static_assert(Counter::is_always_lock_free, "telemetry counters must be lock-free to live in shared memory");
+static_assert(Gauge::is_always_lock_free, "telemetry gauges must be lock-free to live in shared memory");
+
+// Counters only ever increase (readers diff them for rates); gauges are current values.
+// All writes are relaxed: readers see a recent, not necessarily mutually consistent, snapshot.
+struct Block {
+    // Header (written once before the block is published)
+    std::uint32_t magic;
+    std::uint32_t version;
+    std::uint32_t size;          // sizeof(Block) as seen by the writer
+    std::uint32_t writerPid;
+
+    Counter heartbeatMs;         // writer's steady-clock ms at the last publish
+
+    // Monitoring loop
+    Counter iterations;
+    Gauge iterationsPerSec;
+    Gauge probesInWater;         // hand and foot probes currently under the surface (0-4)
+    Counter skips[kSkipReasonCount];
+
+    // Ripples
+    Counter ripplesQueued;
+    Counter ripplesMerged;
+    Counter ripplesDropped;
+    Counter ripplesEmitted;
+    Gauge rippleQueueDepth;
+
+    // Sounds
+    Counter soundsStarted;
+    Counter soundsRejected;      // the audio manager had no voice for the request (stolen / refused)
+
+    // Main-thread tasks
+    Counter tasksPosted;
+    Counter tasksCoalesced;      // requests folded into an already outstanding task
+    Counter tasksDeferred;       // normal/cosmetic tasks held back under frame pressure
+    Counter cosmeticThinned;     // cosmetic work (wakes, wake sounds, tweens) skipped under frame pressure
+    Gauge frameTimeUs;           // smoothed frame time
+    Gauge framePressurePct;      // 0 = within budget, 100 = budget + 30% or worse
+
+    // Other sources
+    Gauge actorsTracked;
+    Gauge thrownObjectsTracked;
+    Counter actorSplashes;
+    Counter thrownSplashes;
+    Counter projectileImpacts;
+
+    // Stage latencies (microseconds): last sample and peak over the last publish period
+    Gauge stageLastUs[kStageCount];
+    Gauge stagePeakUs[kStageCount];
+};
+
+static_assert(sizeof(Block) < 4096, "telemetry block is expected to fit in one page");
+
+} // namespace Telemetry
+} // namespace InteractiveWaterVR
@@ -0,0 +1,529 @@
+// config_tuner.cpp - Searches the hand detection settings that best reproduce labelled recordings
+//
+// Usage:
+//   config_tuner <trace.csv>... [--threads N] [--samples N] [--rounds N] [--seed N]
+//                [--tolerance-ms N] [--cost-weight W] [--range Section.Key=min:max]...
+// A trace is one recording of both hands plus the entries/exits the person meant to make:
+//   s,<t_seconds>,<L|R>,<x>,<y>,<z>,<surfaceZ>      hand sample (surfaceZ empty when over no water)
+//   l,<t_seconds>,<L|R>,<entry|exit>                intended event
+// Lines starting with # are comments. A hand is in the water when it is below surfaceZ.
+//
+// Every candidate config is replayed through the plugin's own detection core (detection_core.cpp,
+// motion_filter.cpp) on every trace; each (trace, config) pair is one task on a work-stealing pool
+// spanning all cores. A splash matches an intended event of the same hand and kind within the
+// tolerance. Score = F1 of the matches - cost-weight * (ripples + sounds per minute) / 100, so among
+// configs that detect equally well the quieter one wins. Round 0 samples the ranges uniformly (plus
+// the plugin defaults); later rounds perturb the best configs with a shrinking step. Prints the
+// ranking and the best config as INI lines.
+
+#include "detection_core.h"
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <deque>
+#include <fstream>
+#include <memory>
+#include <mutex>
+#include <random>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace InteractiveWaterVR;
+
+namespace {
+
+// ============================================================================
+// Parameter space
+// ============================================================================
+
+enum Param : std::size_t {
+    FilterMinCutoff = 0,
+    FilterBeta,
+    FilterDerivCutoff,
+    JitterThreshold,
+    MovingThreshold,
+    MovingConfirmSeconds,
+    EntryDownZThreshold,
+    ExitUpZThreshold,
+    WakeSpawnMs,
+    WakeTrailSpacing,
+    WakeTrailMaxRipples,
+    ParamCount
+};
+
+struct ParamSpec {
+    const char* section;
+    const char* key;
+    float defaultValue;   // the plugin's default (config.cpp)
+    float min;
+    float max;
+    bool integer;
+};
+
+// Ranges stay inside what config.cpp accepts after its clamps
+ParamSpec g_specs[ParamCount] = {
+    { "Movement", "FilterMinCutoff", 1.5f, 0.3f, 6.0f, false },
+    { "Movement", "FilterBeta", 0.05f, 0.0f, 0.3f, false },
+    { "Movement", "FilterDerivCutoff", 12.0f, 2.0f, 30.0f, false },
+    { "Movement", "JitterThreshold", 0.02f, 0.005f, 0.1f, false },
+    { "Movement", "MovingThreshold", 0.08f, 0.02f, 0.4f, false },
+    { "Movement", "MovingConfirmSeconds", 1.0f, 0.1f, 2.0f, false },
+    { "Movement", "EntryDownZThreshold", 0.5f, 0.1f, 200.0f, false },
+    { "Movement", "ExitUpZThreshold", 0.5f, 0.1f, 200.0f, false },
+    { "Wake", "SpawnMs", 0.0f, 0.0f, 200.0f, true },
+    { "Wake", "TrailSpacing", 10.0f, 5.0f, 60.0f, false },
+    { "Wake", "TrailMaxRipples", 6.0f, 1.0f, 16.0f, true },
+};
+
+using Config = std::array<float, ParamCount>;
+
+// Not tuned: the plugin's fixed limits (detection_core.h)
+DetectionParams ToDetectionParams(const Config& c) {
+    DetectionParams p{};
+    p.filter.minCutoffHz = c[FilterMinCutoff];
+    p.filter.beta = c[FilterBeta];
+    p.filter.derivCutoffHz = c[FilterDerivCutoff];
+    p.filter.jitterSpeed = c[JitterThreshold];
+    p.filter.teleportSpeed = kProbeTeleportSpeed;
+    p.movingThreshold = c[MovingThreshold];
+    p.movingConfirmSeconds = c[MovingConfirmSeconds];
+    p.stationarySeconds = kStationaryConfirmSeconds;
+    p.entryMinDownSpeed = c[EntryDownZThreshold];
+    p.entryMaxDownSpeed = kMaxEntryDownSpeed;
+    p.exitMinUpSpeed = c[ExitUpZThreshold];
+    p.exitMaxUpSpeed = kMaxExitUpSpeed;
+    p.minWakeDepth = kMinWakeDepthMeters;
+    p.wakeSpawnMs = static_cast<int>(c[WakeSpawnMs]);
+    p.wakeTrailSpacing = c[WakeTrailSpacing];
+    p.wakeTrailMaxRipples = static_cast<int>(c[WakeTrailMaxRipples]);
+    return p;
+}
+
+Config Normalize(Config c) {
+    for (std::size_t i = 0; i < ParamCount; ++i) {
+        c[i] = std::clamp(c[i], g_specs[i].min, g_specs[i].max);
+        if (g_specs[i].integer) c[i] = std::round(c[i]);
+    }
+    return c;
+}
+
+// ============================================================================
+// Traces
+// ============================================================================
+
+struct TimedSample {
+    double t;
+    HandSample sample;
+};
+
+struct Trace {
+    std::string path;
+    std::vector<TimedSample> hands[2];       // 0 = left, 1 = right; sorted by time
+    std::vector<double> labels[2][2];        // [hand][kind]; sorted
+    double seconds = 0.0;
+};
+
+bool ParseHand(const std::string& s, int& hand) {
+    if (s == "L" || s == "l") hand = 0;
+    else if (s == "R" || s == "r") hand = 1;
+    else return false;
+    return true;
+}
+
+bool LoadTrace(const char* path, Trace& trace) {
+    std::ifstream in(path);
+    if (!in) {
+        std::fprintf(stderr, "%s: cannot open\n", path);
+        return false;
+    }
+    trace.path = path;
+    std::string line;
+    std::size_t lineNo = 0;
+    double first = INFINITY, last = -INFINITY;
+    while (std::getline(in, line)) {
+        ++lineNo;
+        if (!line.empty() && line.back() == '\r') line.pop_back();
+        if (line.empty() || line[0] == '#') continue;
+        std::vector<std::string> f;
+        std::stringstream ss(line);
+        for (std::string field; std::getline(ss, field, ',');) f.push_back(field);
+        if (!line.empty() && line.back() == ',') f.emplace_back();
+        int hand = 0;
+        try {
+            if (f.size() == 7 && f[0] == "s" && ParseHand(f[2], hand)) {
+                TimedSample s{};
+                s.t = std::stod(f[1]);
+                s.sample.x = std::stof(f[3]);
+                s.sample.y = std::stof(f[4]);
+                s.sample.z = std::stof(f[5]);
+                if (!f[6].empty()) {
+                    s.sample.surfaceZ = std::stof(f[6]);
+                    s.sample.inWater = s.sample.z < s.sample.surfaceZ;
+                }
+                trace.hands[hand].push_back(s);
+                first = std::min(first, s.t);
+                last = std::max(last, s.t);
+                continue;
+            }
+            if (f.size() == 4 && f[0] == "l" && ParseHand(f[2], hand) && (f[3] == "entry" || f[3] == "exit")) {
+                trace.labels[hand][f[3] == "entry" ? 0 : 1].push_back(std::stod(f[1]));
+                continue;
+            }
+        } catch (...) {
+        }
+        std::fprintf(stderr, "%s:%zu: malformed line\n", path, lineNo);
+        return false;
+    }
+    for (auto& h : trace.hands) {
+        std::stable_sort(h.begin(), h.end(), [](const TimedSample& a, const TimedSample& b) { return a.t < b.t; });
+    }
+    for (auto& h : trace.labels) {
+        for (auto& k : h) std::sort(k.begin(), k.end());
+    }
+    trace.seconds = last > first ? last - first : 0.0;
+    return true;
+}
+
+// ============================================================================
+// Replay and scoring
+// ============================================================================
+
+struct ReplayResult {
+    std::uint32_t matched = 0;     // splashes that match an intended event
+    std::uint32_t detected = 0;    // all entry/exit splashes
+    std::uint32_t labelled = 0;    // intended events
+    std::uint32_t ripples = 0;     // splashes + wake ripples
+    std::uint32_t sounds = 0;      // splash sounds + wake move sounds
+    double seconds = 0.0;
+
+    void Add(const ReplayResult& r) {
+        matched += r.matched;
+        detected += r.detected;
+        labelled += r.labelled;
+        ripples += r.ripples;
+        sounds += r.sounds;
+        seconds += r.seconds;
+    }
+};
+
+// Greedy in time order: each label takes the earliest unmatched detection within the tolerance
+std::uint32_t MatchEvents(const std::vector<double>& labels, const std::vector<double>& detections, double tolerance) {
+    std::uint32_t matched = 0;
+    std::size_t d = 0;
+    for (double label : labels) {
+        while (d < detections.size() && detections[d] < label - tolerance) ++d;
+        if (d < detections.size() && detections[d] <= label + tolerance) {
+            ++matched;
+            ++d;
+        }
+    }
+    return matched;
+}
+
+ReplayResult Replay(const Trace& trace, const DetectionParams& params, double tolerance) {
+    ReplayResult r;
+    r.seconds = trace.seconds;
+    std::vector<double> detections[2];
+    for (int hand = 0; hand < 2; ++hand) {
+        HandDetector detector;
+        detections[0].clear();
+        detections[1].clear();
+        double prevT = 0.0;
+        bool havePrev = false;
+        for (const TimedSample& s : trace.hands[hand]) {
+            const float dt = havePrev ? static_cast<float>(s.t - prevT) : 0.0f;
+            prevT = s.t;
+            havePrev = true;
+            const HandEvents& ev = detector.Update(s.sample, dt, params);
+            if (ev.transition.splash) {
+                detections[ev.transition.entered ? 0 : 1].push_back(s.t);
+                ++r.ripples;
+                ++r.sounds;
+            }
+            r.ripples += static_cast<std::uint32_t>(ev.wakeRipples);
+            if (ev.wakeSound) ++r.sounds;
+        }
+        for (int kind = 0; kind < 2; ++kind) {
+            r.detected += static_cast<std::uint32_t>(detections[kind].size());
+            r.labelled += static_cast<std::uint32_t>(trace.labels[hand][kind].size());
+            r.matched += MatchEvents(trace.labels[hand][kind], detections[kind], tolerance);
+        }
+    }
+    return r;
+}
+
+struct Score {
+    double precision = 0.0;
+    double recall = 0.0;
+    double f1 = 0.0;
+    double ripplesPerMin = 0.0;
+    double soundsPerMin = 0.0;
+    double value = 0.0;
+};
+
+Score ComputeScore(const ReplayResult& r, double costWeight) {
+    Score s;
+    s.precision = r.detected > 0 ? static_cast<double>(r.matched) / r.detected : (r.labelled == 0 ? 1.0 : 0.0);
+    s.recall = r.labelled > 0 ? static_cast<double>(r.matched) / r.labelled : 1.0;
+    s.f1 = s.precision + s.recall > 0.0 ? 2.0 * s.precision * s.recall / (s.precision + s.recall) : 0.0;
+    const double minutes = std::max(r.seconds / 60.0, 1.0 / 60.0);
+    s.ripplesPerMin = r.ripples / minutes;
+    s.soundsPerMin = r.sounds / minutes;
+    s.value = s.f1 - costWeight * (s.ripplesPerMin + s.soundsPerMin) / 100.0;
+    return s;
+}
+
+// ============================================================================
+// Work-stealing pool
+// ============================================================================
+
+// Tasks are dealt to the workers in contiguous blocks (neighbouring tasks share a config). A worker
+// takes from the back of its own queue and, once that is empty, steals from the front of the others,
+// so a worker stuck on long traces is relieved of the tasks it would have reached last.
+class WorkStealingPool {
+public:
+    explicit WorkStealingPool(unsigned threads) : _queues(threads) {
+        for (auto& q : _queues) q = std::make_unique<Queue>();
+    }
+
+    template <class Fn>
+    void Run(std::size_t taskCount, Fn&& fn) {
+        const std::size_t n = _queues.size();
+        for (std::size_t w = 0; w < n; ++w) {
+            const std::size_t begin = taskCount * w / n;
+            const std::size_t end = taskCount * (w + 1) / n;
+            for (std::size_t t = begin; t < end; ++t) _queues[w]->tasks.push_back(t);
+        }
+        std::vector<std::thread> workers;
+        workers.reserve(n);
+        for (std::size_t w = 0; w < n; ++w) {
+            workers.emplace_back([this, w, n, &fn]() {
+                std::size_t task = 0;
+                for (;;) {
+                    if (!PopOwn(w, task)) {
+                        bool stolen = false;
+                        for (std::size_t k = 1; k < n && !stolen; ++k) stolen = Steal((w + k) % n, task);
+                        if (!stolen) return;  // every queue is empty and nothing adds tasks
+                        _steals.fetch_add(1, std::memory_order_relaxed);
+                    }
+                    fn(task);
+                }
+            });
+        }
+        for (auto& t : workers) t.join();
+    }
+
+    std::size_t Steals() const { return _steals.load(); }
+
+private:
+    struct Queue {
+        std::mutex mutex;
+        std::deque<std::size_t> tasks;
+    };
+
+    bool PopOwn(std::size_t w, std::size_t& task) {
+        std::lock_guard lock(_queues[w]->mutex);
+        if (_queues[w]->tasks.empty()) return false;
+        task = _queues[w]->tasks.back();
+        _queues[w]->tasks.pop_back();
+        return true;
+    }
+
+    bool Steal(std::size_t victim, std::size_t& task) {
+        std::lock_guard lock(_queues[victim]->mutex);
+        if (_queues[victim]->tasks.empty()) return false;
+        task = _queues[victim]->tasks.front();
+        _queues[victim]->tasks.pop_front();
+        return true;
+    }
+
+    std::vector<std::unique_ptr<Queue>> _queues;
+    std::atomic<std::size_t> _steals{ 0 };
+};
+
+// ============================================================================
+// Search
+// ============================================================================
+
+struct Candidate {
+    Config config{};
+    ReplayResult total;
+    Score score;
+};
+
+struct Options {
+    unsigned threads = 0;
+    std::size_t samples = 256;
+    std::size_t rounds = 4;
+    std::uint32_t seed = 1;
+    double toleranceMs = 150.0;
+    double costWeight = 0.05;
+};
+
+bool ParseRange(const char* arg) {
+    const char* eq = std::strchr(arg, '=');
+    const char* colon = eq ? std::strchr(eq, ':') : nullptr;
+    if (!eq || !colon) return false;
+    const std::string name(arg, eq);
+    for (auto& spec : g_specs) {
+        if (name != std::string(spec.section) + "." + spec.key && name != spec.key) continue;
+        spec.min = std::strtof(eq + 1, nullptr);
+        spec.max = std::strtof(colon + 1, nullptr);
+        if (spec.max < spec.min) std::swap(spec.min, spec.max);
+        return true;
+    }
+    return false;
+}
+
+void Evaluate(std::vector<Candidate>& candidates, const std::vector<Trace>& traces, const Options& opt,
+              std::size_t& replays, std::size_t& steals) {
+    std::vector<DetectionParams> params;
+    params.reserve(candidates.size());
+    for (const auto& c : candidates) params.push_back(ToDetectionParams(c.config));
+
+    const std::size_t taskCount = candidates.size() * traces.size();
+    std::vector<ReplayResult> results(taskCount);
+    WorkStealingPool pool(opt.threads);
+    pool.Run(taskCount, [&](std::size_t task) {
+        const std::size_t c = task / traces.size();
+        const std::size_t t = task % traces.size();
+        results[task] = Replay(traces[t], params[c], opt.toleranceMs / 1000.0);
+    });
+
+    for (std::size_t c = 0; c < candidates.size(); ++c) {
+        candidates[c].total = ReplayResult{};
+        for (std::size_t t = 0; t < traces.size(); ++t) candidates[c].total.Add(results[c * traces.size() + t]);
+        candidates[c].score = ComputeScore(candidates[c].total, opt.costWeight);
+    }
+    replays += taskCount;
+    steals += pool.Steals();
+}
+
+void PrintCandidate(const char* label, const Candidate& c) {
+    std::printf("%-9s score %.4f  precision %.3f recall %.3f F1 %.3f  ripples/min %.1f sounds/min %.1f\n", label,
+        c.score.value, c.score.precision, c.score.recall, c.score.f1, c.score.ripplesPerMin, c.score.soundsPerMin);
+}
+
+void PrintConfig(const Config& c) {
+    const char* section = nullptr;
+    for (std::size_t i = 0; i < ParamCount; ++i) {
+        if (!section || std::strcmp(section, g_specs[i].section) != 0) {
+            section = g_specs[i].section;
+            std::printf("%s[%s]\n", i ? "\n" : "", section);
+        }
+        if (g_specs[i].integer) std::printf("%s=%d\n", g_specs[i].key, static_cast<int>(c[i]));
+        else std::printf("%s=%g\n", g_specs[i].key, c[i]);
+    }
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+    Options opt;
+    std::vector<const char*> paths;
+    for (int i = 1; i < argc; ++i) {
+        const char* a = argv[i];
+        const bool hasValue = i + 1 < argc;
+        if (!std::strcmp(a, "--threads") && hasValue) opt.threads = static_cast<unsigned>(std::atoi(argv[++i]));
+        else if (!std::strcmp(a, "--samples") && hasValue) opt.samples = static_cast<std::size_t>(std::atoll(argv[++i]));
+        else if (!std::strcmp(a, "--rounds") && hasValue) opt.rounds = static_cast<std::size_t>(std::atoll(argv[++i]));
+        else if (!std::strcmp(a, "--seed") && hasValue) opt.seed = static_cast<std::uint32_t>(std::strtoul(argv[++i], nullptr, 0));
+        else if (!std::strcmp(a, "--tolerance-ms") && hasValue) opt.toleranceMs = std::atof(argv[++i]);
+        else if (!std::strcmp(a, "--cost-weight") && hasValue) opt.costWeight = std::atof(argv[++i]);
+        else if (!std::strcmp(a, "--range") && hasValue) {
+            if (!ParseRange(argv[++i])) {
+                std::fprintf(stderr, "bad --range %s (expected Section.Key=min:max)\n", argv[i]);
+                return 2;
+            }
+        } else if (a[0] == '-') {
+            std::fprintf(stderr, "unknown option %s\n", a);
+            return 2;
+        } else {
+            paths.push_back(a);
+        }
+    }
+    if (paths.empty()) {
+        std::fprintf(stderr,
+            "usage: config_tuner <trace.csv>... [--threads N] [--samples N] [--rounds N] [--seed N]\n"
+            "                    [--tolerance-ms N] [--cost-weight W] [--range Section.Key=min:max]...\n");
+        return 2;
+    }
+    if (opt.threads == 0) opt.threads = std::max(1u, std::thread::hardware_concurrency());
+    opt.samples = std::max<std::size_t>(opt.samples, 1);
+
+    std::vector<Trace> traces(paths.size());
+    std::size_t labelled = 0;
+    double seconds = 0.0;
+    for (std::size_t i = 0; i < paths.size(); ++i) {
+        if (!LoadTrace(paths[i], traces[i])) return 1;
+        seconds += traces[i].seconds;
+        for (auto& h : traces[i].labels) labelled += h[0].size() + h[1].size();
+    }
+    std::printf("%zu traces, %.1f s recorded, %zu intended events; %u threads\n", traces.size(), seconds, labelled,
+        opt.threads);
+
+    const auto start = std::chrono::steady_clock::now();
+    std::mt19937 rng(opt.seed);
+    std::size_t replays = 0, steals = 0;
+
+    // Round 0: the plugin defaults plus uniform samples over the ranges
+    Config defaults{};
+    for (std::size_t i = 0; i < ParamCount; ++i) defaults[i] = g_specs[i].defaultValue;
+    std::vector<Candidate> candidates(opt.samples + 1);
+    candidates[0].config = defaults;
+    for (std::size_t c = 1; c < candidates.size(); ++c) {
+        for (std::size_t i = 0; i < ParamCount; ++i) {
+            candidates[c].config[i] = std::uniform_real_distribution<float>(g_specs[i].min, g_specs[i].max)(rng);
+        }
+        candidates[c].config = Normalize(candidates[c].config);
+    }
+    Evaluate(candidates, traces, opt, replays, steals);
+    const Candidate baseline = candidates[0];
+
+    auto byScore = [](const Candidate& a, const Candidate& b) { return a.score.value > b.score.value; };
+    std::vector<Candidate> best = candidates;
+    std::sort(best.begin(), best.end(), byScore);
+
+    // Later rounds: perturb the current leaders; the step shrinks by half each round
+    constexpr std::size_t kParents = 8;
+    for (std::size_t round = 1; round <= opt.rounds; ++round) {
+        const std::size_t parents = std::min(kParents, best.size());
+        const float step = 0.2f * std::ldexp(1.0f, -static_cast<int>(round - 1));
+        candidates.assign(opt.samples, Candidate{});
+        for (std::size_t c = 0; c < candidates.size(); ++c) {
+            const Config& parent = best[c % parents].config;
+            for (std::size_t i = 0; i < ParamCount; ++i) {
+                const float sigma = step * (g_specs[i].max - g_specs[i].min);
+                candidates[c].config[i] = parent[i] + std::normal_distribution<float>(0.0f, sigma)(rng);
+            }
+            candidates[c].config = Normalize(candidates[c].config);
+        }
+        Evaluate(candidates, traces, opt, replays, steals);
+        best.insert(best.end(), candidates.begin(), candidates.end());
+        std::sort(best.begin(), best.end(), byScore);
+        best.resize(std::min<std::size_t>(best.size(), 64));
+        std::printf("round %zu: best score %.4f (F1 %.3f)\n", round, best[0].score.value, best[0].score.f1);
+    }
+
+    const double elapsed = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    std::printf("%zu replays in %.2f s (%.0f/s), %zu steals\n\n", replays, elapsed, replays / std::max(elapsed, 1e-9),
+        steals);
+    PrintCandidate("defaults", baseline);
+    char label[24];
+    for (std::size_t i = 0; i < std::min<std::size_t>(best.size(), 5); ++i) {
+        std::snprintf(label, sizeof(label), "#%zu", i + 1);
+        PrintCandidate(label, best[i]);
+    }
+    std::printf("\n; best config (Interactive_Water_VR.ini)\n");
+    PrintConfig(best[0].config);
+    return 0;
+}
@@ -0,0 +1,186 @@
+// periodic_schedule_test.cpp - Drives periodic_schedule.h with a fake clock
+//
+// Usage:
+//   periodic_schedule_test
+// Checks PeriodicDeadline::Advance (fixed grid, no drift, skipped slots after overruns),
+// WaitUntilPrecise (sleep then spin, early wake-up, deadlines already due or inside the spin window)
+// and PeriodJitter (deviation percentiles, skipped slots, Take clearing the window). The clock only
+// moves when the test or the wait's sleep/relax callbacks move it, so every result is exact.
+// Exits 0 when every check passes.
+
+#include "periodic_schedule.h"
+
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+
+using namespace InteractiveWaterVR;
+using namespace std::chrono_literals;
+
+namespace {
+
+struct FakeClock {
+    using rep = long long;
+    using period = std::micro;
+    using duration = std::chrono::microseconds;
+    using time_point = std::chrono::time_point<FakeClock>;
+    static constexpr bool is_steady = true;
+
+    static time_point now() { return current; }
+    static inline time_point current{};
+};
+
+using Us = std::chrono::microseconds;
+
+int s_failures = 0;
+
+void Check(bool ok, const char* what) {
+    std::printf("%s %s\n", ok ? "PASS" : "FAIL", what);
+    if (!ok) ++s_failures;
+}
+
+FakeClock::time_point At(Us t) {
+    return FakeClock::time_point{ t };
+}
+
+// ============================================================================
+// PeriodicDeadline
+// ============================================================================
+
+void TestDeadline() {
+    PeriodicDeadline<FakeClock> d;
+    d.Start(At(1000us));
+
+    Check(d.Advance(At(1300us), 1000us) == 0 && d.Due() == At(2000us), "run inside its period: next slot on the grid");
+    Check(d.Advance(At(2999us), 1000us) == 0 && d.Due() == At(3000us), "run finishing just before the next slot skips nothing");
+    // Finished at 5500: slots 4000 and 5000 are gone, the grid phase is kept
+    Check(d.Advance(At(5500us), 1000us) == 2 && d.Due() == At(6000us), "overrun skips whole slots and keeps the phase");
+    Check(d.Advance(At(7000us), 1000us) == 1 && d.Due() == At(8000us), "finishing exactly on the next slot skips it");
+
+    // Work time and late wake-ups never move the grid
+    PeriodicDeadline<FakeClock> g;
+    g.Start(At(0us));
+    bool onGrid = true;
+    for (long long n = 1; n <= 10000; ++n) {
+        const Us work{ 100 + (n * 37) % 800 };
+        onGrid &= g.Advance(g.Due() + work, 1000us) == 0;
+        onGrid &= g.Due() == At(Us{ n * 1000 });
+    }
+    Check(onGrid, "10000 periods with varying work stay on the grid (no drift)");
+
+    PeriodicDeadline<FakeClock> z;
+    z.Start(At(0us));
+    Check(z.Advance(At(1234us), 0us) == 0 && z.Due() == At(1234us), "zero period: due immediately");
+}
+
+// ============================================================================
+// WaitUntilPrecise
+// ============================================================================
+
+struct WaitCounts {
+    int sleeps = 0;
+    int relaxes = 0;
+    FakeClock::time_point sleptUntil{};
+};
+
+// The fake sleep overshoots its target by `oversleep`; each spin iteration costs `spinStep`
+bool Wait(FakeClock::time_point due, Us spin, Us oversleep, Us spinStep, bool interrupt, WaitCounts& c) {
+    return WaitUntilPrecise<FakeClock>(due, spin,
+        [&](FakeClock::time_point tp) {
+            ++c.sleeps;
+            c.sleptUntil = tp;
+            if (interrupt) {
+                FakeClock::current += 10us;
+                return false;
+            }
+            FakeClock::current = tp + oversleep;
+            return true;
+        },
+        [&]() {
+            ++c.relaxes;
+            FakeClock::current += spinStep;
+        });
+}
+
+void TestWait() {
+    {
+        FakeClock::current = At(0us);
+        WaitCounts c;
+        const bool ok = Wait(At(10000us), 1500us, 900us, 10us, false, c);
+        Check(ok && c.sleeps == 1 && c.sleptUntil == At(8500us), "far deadline: one sleep until spin before it");
+        Check(FakeClock::now() >= At(10000us) && FakeClock::now() < At(10010us), "spin ends within one step of the deadline");
+        Check(c.relaxes == 60, "spin covers only what the sleep left");
+    }
+    {
+        FakeClock::current = At(0us);
+        WaitCounts c;
+        const bool ok = Wait(At(10000us), 1500us, 2000us, 10us, false, c);
+        Check(ok && c.relaxes == 0 && FakeClock::now() == At(10500us), "sleep overshooting the spin window returns late without spinning");
+    }
+    {
+        FakeClock::current = At(0us);
+        WaitCounts c;
+        const bool ok = Wait(At(10000us), 1500us, 0us, 10us, true, c);
+        Check(!ok && c.sleeps == 1 && c.relaxes == 0 && FakeClock::now() < At(10000us), "interrupted sleep returns false before the deadline");
+    }
+    {
+        FakeClock::current = At(9000us);
+        WaitCounts c;
+        const bool ok = Wait(At(10000us), 1500us, 0us, 100us, false, c);
+        Check(ok && c.sleeps == 0 && c.relaxes == 10 && FakeClock::now() == At(10000us), "deadline inside the spin window: spin only");
+    }
+    {
+        FakeClock::current = At(12000us);
+        WaitCounts c;
+        const bool ok = Wait(At(10000us), 1500us, 0us, 10us, false, c);
+        Check(ok && c.sleeps == 0 && c.relaxes == 0 && FakeClock::now() == At(12000us), "deadline already passed: returns at once");
+    }
+}
+
+// ============================================================================
+// PeriodJitter
+// ============================================================================
+
+void TestJitter() {
+    PeriodJitter j;
+    for (int i = 0; i < 90; ++i) j.Add(11020, 11000);     // 20 us late
+    for (int i = 0; i < 5; ++i) j.Add(10880, 11000);      // 120 us early
+    for (int i = 0; i < 5; ++i) j.Add(12500, 11000);      // 1500 us late
+    j.AddSkipped(3);
+    const PeriodJitter::Summary s = j.Take();
+    Check(s.count == 100 && s.skipped == 3, "count and skipped slots");
+    Check(s.meanNominalUs == 11000.0 && s.meanPeriodUs == (90 * 11020.0 + 5 * 10880.0 + 5 * 12500.0) / 100.0, "mean period and nominal");
+    Check(s.p50DevUs == 50, "p50 deviation is its bucket's upper bound");
+    Check(s.p95DevUs == 150, "p95 deviation lands in the early samples' bucket");
+    Check(s.maxDevUs == 1500, "max deviation is exact");
+
+    const PeriodJitter::Summary empty = j.Take();
+    Check(empty.count == 0 && empty.skipped == 0 && empty.maxDevUs == 0 && empty.p95DevUs == 0, "Take clears the window");
+
+    PeriodJitter tail;
+    tail.Add(1000000, 11000);
+    const PeriodJitter::Summary t = tail.Take();
+    Check(t.p50DevUs == PeriodJitter::kBuckets * PeriodJitter::kBucketUs && t.maxDevUs == 989000,
+        "tail deviations land in the last bucket; the max stays exact");
+
+    // The worker runtime measures the start after an overrun against 1 + skipped periods
+    PeriodicDeadline<FakeClock> d;
+    d.Start(At(0us));
+    PeriodJitter skip;
+    const FakeClock::time_point lastStart = At(0us);
+    const std::uint32_t skipped = d.Advance(At(2500us), 1000us);
+    const Us nominal = 1000us * (1 + skipped);
+    skip.Add((d.Due() - lastStart).count(), nominal.count());
+    const PeriodJitter::Summary k = skip.Take();
+    Check(skipped == 2 && k.maxDevUs == 0, "a start after skipped slots is on time against 1 + skipped periods");
+}
+
+}  // namespace
+
+int main() {
+    TestDeadline();
+    TestWait();
+    TestJitter();
+    std::printf("%s\n", s_failures == 0 ? "OK" : "FAILED");
+    return s_failures == 0 ? 0 : 1;
+}
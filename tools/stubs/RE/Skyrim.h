@@ -0,0 +1,29 @@
+#pragma once
+// RE/Skyrim.h (test stub) - Declarations the plugin headers name but the standalone tests never
+// use. Not part of the plugin build.
+
+#include <cstdint>
+
+namespace RE {
+
+namespace BSScript::Internal {
+class VirtualMachine;
+}
+
+enum class FormType : std::uint8_t {};
+
+class TESForm {
+public:
+    static TESForm* LookupByID(std::uint32_t formID);
+    bool Is(FormType type) const;
+};
+
+class TESObjectREFR;
+class NiObject;
+class NiTransform;
+
+} // namespace RE
+
+namespace REL {
+template <class T> class Relocation;
+}
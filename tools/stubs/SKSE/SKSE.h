@@ -0,0 +1,33 @@
+#pragma once
+// SKSE/SKSE.h (test stub) - The part of the SKSE API that main_thread_tasks.cpp and the headers it
+// includes use, so the standalone tests under tools/ can build it without CommonLib. The test
+// defines GetTaskInterface and TaskInterface::AddTask. Not part of the plugin build.
+
+#include <cstdint>
+
+namespace SKSE {
+
+using PluginHandle = std::uint32_t;
+class MessagingInterface;
+
+class TaskDelegate {
+public:
+    virtual ~TaskDelegate() = default;
+    virtual void Run() = 0;
+    virtual void Dispose() = 0;
+};
+
+class TaskInterface {
+public:
+    void AddTask(TaskDelegate* task) const;
+};
+
+const TaskInterface* GetTaskInterface() noexcept;
+
+namespace log {
+template <class... Args> void info(Args&&...) {}
+template <class... Args> void warn(Args&&...) {}
+template <class... Args> void error(Args&&...) {}
+}
+
+} // namespace SKSE
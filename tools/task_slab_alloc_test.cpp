@@ -0,0 +1,240 @@
+// task_slab_alloc_test.cpp - Checks that posting main-thread tasks does not touch the heap
+//
+// Usage:
+//   task_slab_alloc_test
+// Builds main_thread_tasks.cpp against the stub SKSE/RE headers in tools/stubs. The stub task
+// interface queues tasks in a fixed array and a "frame" runs and disposes all of them, like SKSE's
+// drain. Every global operator new is counted. After one warm-up frame, 1000 frames of 20 posts
+// each (mixed priorities and capture sizes, dispatcher on) must allocate nothing and leave the slab
+// empty; then posting one task more than the slab holds must fall back to the heap exactly once.
+// Last, frames are slowed past the budget until a coalesced (pending-flag) task is deferred; a
+// session reset drops it, and the poster's next request must post and run instead of coalescing.
+// Exits 0 when every check passes.
+
+#include "main_thread_tasks.h"
+#include "telemetry.h"
+#include "higgsinterface.h"
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <new>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace InteractiveWaterVR;
+
+// ============================================================================
+// Allocation counting
+// ============================================================================
+
+namespace {
+std::atomic<bool> s_counting{ false };
+std::atomic<std::uint64_t> s_allocations{ 0 };
+
+void* CountedAlloc(std::size_t size) {
+    if (s_counting.load(std::memory_order_relaxed)) s_allocations.fetch_add(1, std::memory_order_relaxed);
+    if (void* p = std::malloc(size ? size : 1)) return p;
+    throw std::bad_alloc();
+}
+}  // namespace
+
+void* operator new(std::size_t size) { return CountedAlloc(size); }
+void* operator new[](std::size_t size) { return CountedAlloc(size); }
+void operator delete(void* p) noexcept { std::free(p); }
+void operator delete[](void* p) noexcept { std::free(p); }
+void operator delete(void* p, std::size_t) noexcept { std::free(p); }
+void operator delete[](void* p, std::size_t) noexcept { std::free(p); }
+
+// ============================================================================
+// Stubs for what main_thread_tasks.cpp links against
+// ============================================================================
+
+namespace {
+constexpr std::size_t kQueueCapacity = 1024;
+std::array<SKSE::TaskDelegate*, kQueueCapacity> s_queue{};
+std::size_t s_queued = 0;
+bool s_queueOverflow = false;
+const SKSE::TaskInterface s_taskInterface;
+Telemetry::Block s_telemetry{};
+}  // namespace
+
+void SKSE::TaskInterface::AddTask(TaskDelegate* task) const {
+    if (s_queued == kQueueCapacity) {
+        s_queueOverflow = true;
+        task->Dispose();
+        return;
+    }
+    s_queue[s_queued++] = task;
+}
+
+const SKSE::TaskInterface* SKSE::GetTaskInterface() noexcept {
+    return &s_taskInterface;
+}
+
+namespace HiggsPluginAPI {
+IHiggsInterface001* g_higgsInterface = nullptr;
+}
+
+namespace InteractiveWaterVR {
+bool cfgDispatcherEnabled = true;
+float cfgFrameBudgetMs = 50.0f;
+
+Telemetry::Block& TelemetryBlock() { return s_telemetry; }
+void AppendToPluginLog(const char*, const char*, ...) {}
+void AppendLinesToPluginLog(const char*, const std::vector<std::string>&) {}
+}  // namespace InteractiveWaterVR
+
+// ============================================================================
+// Frames
+// ============================================================================
+
+namespace {
+constexpr int kFrames = 1000;
+constexpr int kPostsPerFrame = 20;
+
+std::uint64_t s_posted = 0;
+std::uint64_t s_runs = 0;
+
+// Roughly the captures the plugin posts: a handle, a splash (position + amounts), a node + transform
+struct SplashCapture {
+    float x, y, z, amt, speed, volume;
+    std::uint32_t flags;
+};
+struct MoveCapture {
+    void* ref;
+    void* target;
+    float offset[6];
+};
+
+// SKSE runs everything queued, including tasks queued while draining (the deferred drain task)
+void RunFrame() {
+    for (std::size_t i = 0; i < s_queued; ++i) {
+        SKSE::TaskDelegate* task = s_queue[i];
+        task->Run();
+        task->Dispose();
+    }
+    s_queued = 0;
+}
+
+void PostFrame(int frame) {
+    for (int i = 0; i < kPostsPerFrame; ++i) {
+        switch (i % 4) {
+            case 0:
+                PostTask(TaskType::EntrySplash, [frame]() { s_runs += frame >= 0 ? 1 : 0; });
+                break;
+            case 1: {
+                const SplashCapture c{ 1.0f, 2.0f, 3.0f, 0.5f, 120.0f, 1.0f, static_cast<std::uint32_t>(i) };
+                PostTask(TaskType::StrokeSplash, [c]() { s_runs += c.flags < kPostsPerFrame ? 1 : 0; });
+                break;
+            }
+            case 2: {
+                const MoveCapture c{ &s_runs, nullptr, { 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 0.0f } };
+                PostTask(TaskType::MoveTo, [c]() { s_runs += c.ref ? 1 : 0; });
+                break;
+            }
+            default:
+                PostTask(TaskType::ScaleStep, [i]() { s_runs += i >= 0 ? 1 : 0; });
+                break;
+        }
+    }
+    s_posted += kPostsPerFrame;
+    PumpDeferredTasks();
+    RunFrame();
+}
+
+// Frame pressure can defer work behind a slow frame; keep draining until it has all run
+void FinishDeferred() {
+    for (int i = 0; i < 64 && s_runs < s_posted; ++i) {
+        PumpDeferredTasks();
+        RunFrame();
+    }
+}
+
+// The plugin's coalesced posters (actor update, projectile scan, spawn flush): one task in flight
+std::atomic<bool> s_coalescePending{ false };
+int s_coalescedRuns = 0;
+
+bool PostCoalesced() {
+    if (s_coalescePending.exchange(true)) return false;
+    PostTask(TaskType::ActorUpdate, []() {
+        s_coalescePending.store(false);
+        ++s_coalescedRuns;
+    }, []() { s_coalescePending.store(false); });
+    return true;
+}
+
+// Frames spaced 2 ms apart against a 1 ms budget until normal work is deferred
+bool BuildFramePressure() {
+    cfgFrameBudgetMs = 1.0f;
+    for (int i = 0; i < 500 && GetFramePressure() < 0.9f; ++i) {
+        PostTask(TaskType::EntrySplash, []() {});
+        RunFrame();
+        std::this_thread::sleep_for(std::chrono::milliseconds(2));
+    }
+    return GetFramePressure() >= 0.9f;
+}
+
+int Check(bool ok, const char* what) {
+    std::printf("%s %s\n", ok ? "PASS" : "FAIL", what);
+    return ok ? 0 : 1;
+}
+}  // namespace
+
+int main() {
+    int failures = 0;
+
+    // Warm-up: first-use initialisation is not steady state
+    PostFrame(-1);
+    FinishDeferred();
+    s_posted = 0;
+    s_runs = 0;
+
+    s_counting.store(true);
+    for (int f = 0; f < kFrames; ++f) PostFrame(f);
+    FinishDeferred();
+    s_counting.store(false);
+
+    const std::uint64_t allocations = s_allocations.load();
+    const TaskSlabStats steady = GetTaskSlabStats();
+    std::printf("%d frames x %d posts: %llu tasks run, %llu allocations, slab %u/%u in use, peak %u, heap tasks %llu\n",
+        kFrames, kPostsPerFrame, static_cast<unsigned long long>(s_runs), static_cast<unsigned long long>(allocations),
+        steady.inUse, steady.capacity, steady.peakInUse, static_cast<unsigned long long>(steady.heapAllocations));
+    failures += Check(s_runs == s_posted && s_posted == static_cast<std::uint64_t>(kFrames) * kPostsPerFrame, "every posted task ran once");
+    failures += Check(allocations == 0, "steady-state posting allocates nothing");
+    failures += Check(steady.heapAllocations == 0, "no task fell back to the heap");
+    failures += Check(steady.inUse == 0, "every slab task went back to the slab");
+
+    // Exhaust the slab without draining: the one task past capacity comes from the heap
+    for (std::uint32_t i = 0; i <= steady.capacity; ++i) {
+        PostTask(TaskType::EntrySplash, []() { ++s_runs; });
+    }
+    const TaskSlabStats full = GetTaskSlabStats();
+    RunFrame();
+    const TaskSlabStats drained = GetTaskSlabStats();
+    failures += Check(!s_queueOverflow, "stub task queue held every post");
+    failures += Check(full.heapAllocations == 1, "one post past capacity fell back to the heap");
+    failures += Check(full.inUse == full.capacity, "the full slab was in use");
+    failures += Check(drained.inUse == 0, "the slab drained back to empty");
+
+    // A deferred coalesced task dropped by a reset must not leave its poster coalescing forever
+    failures += Check(BuildFramePressure(), "slow frames raise the frame pressure");
+    const bool posted = PostCoalesced();
+    const bool deferred = s_queued == 0 && GetTaskSlabStats().inUse == 1;
+    failures += Check(posted && deferred, "the coalesced task was deferred");
+    failures += Check(ResetDeferredTasks() == 1 && GetTaskSlabStats().inUse == 0, "the reset dropped the deferred task");
+    failures += Check(PostCoalesced(), "the next request posts instead of coalescing");
+    for (int i = 0; i < 8 && s_coalescedRuns == 0; ++i) {
+        PumpDeferredTasks();
+        RunFrame();
+    }
+    failures += Check(s_coalescedRuns == 1 && GetTaskSlabStats().inUse == 0, "the reposted task ran");
+
+    std::printf("%s\n", failures == 0 ? "OK" : "FAILED");
+    return failures == 0 ? 0 : 1;
+}
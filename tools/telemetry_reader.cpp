@@ -0,0 +1,158 @@
+// telemetry_reader.cpp - Prints the plugin's live telemetry block once per second
+//
+// Usage:
+//   telemetry_reader [file]
+// With a file argument the block is read from a file-backed mapping ([Telemetry] File=...),
+// which works on Linux as well as Windows. Without one, the named mapping is opened (Windows only).
+
+#include "telemetry_layout.h"
+
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <thread>
+
+#if defined(_WIN32)
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+using namespace InteractiveWaterVR;
+
+namespace {
+
+const Telemetry::Block* MapBlock(const char* path) {
+#if defined(_WIN32)
+    HANDLE mapping = nullptr;
+    if (path) {
+        HANDLE file = CreateFileA(path, GENERIC_READ, FILE_SHARE_READ | FILE_SHARE_WRITE, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+        if (file == INVALID_HANDLE_VALUE) return nullptr;
+        mapping = CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+    } else {
+        mapping = OpenFileMappingA(FILE_MAP_READ, FALSE, Telemetry::kMappingName);
+    }
+    if (!mapping) return nullptr;
+    return static_cast<const Telemetry::Block*>(MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, sizeof(Telemetry::Block)));
+#else
+    if (!path) {
+        std::fprintf(stderr, "a file path is required on this platform (set [Telemetry] File= in the plugin INI)\n");
+        return nullptr;
+    }
+    const int fd = open(path, O_RDONLY);
+    if (fd < 0) return nullptr;
+    struct stat st {};
+    if (fstat(fd, &st) != 0 || st.st_size < static_cast<off_t>(sizeof(Telemetry::Block))) {
+        close(fd);
+        return nullptr;
+    }
+    void* view = mmap(nullptr, sizeof(Telemetry::Block), PROT_READ, MAP_SHARED, fd, 0);
+    close(fd);
+    return view == MAP_FAILED ? nullptr : static_cast<const Telemetry::Block*>(view);
+#endif
+}
+
+std::uint64_t Load(const Telemetry::Counter& c) {
+    return c.load(std::memory_order_relaxed);
+}
+
+std::uint32_t Load(const Telemetry::Gauge& g) {
+    return g.load(std::memory_order_relaxed);
+}
+
+// Counters that are shown as per-second rates
+struct RateSnapshot {
+    std::uint64_t ripplesQueued = 0;
+    std::uint64_t ripplesEmitted = 0;
+    std::uint64_t soundsStarted = 0;
+    std::uint64_t tasksPosted = 0;
+    std::uint64_t tasksCoalesced = 0;
+    std::uint64_t tasksDeferred = 0;
+};
+
+RateSnapshot TakeRates(const Telemetry::Block& b) {
+    RateSnapshot r;
+    r.ripplesQueued = Load(b.ripplesQueued);
+    r.ripplesEmitted = Load(b.ripplesEmitted);
+    r.soundsStarted = Load(b.soundsStarted);
+    r.tasksPosted = Load(b.tasksPosted);
+    r.tasksCoalesced = Load(b.tasksCoalesced);
+    r.tasksDeferred = Load(b.tasksDeferred);
+    return r;
+}
+
+void Print(const Telemetry::Block& b, const RateSnapshot& prev, const RateSnapshot& cur, double secs) {
+    auto rate = [secs](std::uint64_t a, std::uint64_t c) { return secs > 0.0 ? static_cast<double>(c - a) / secs : 0.0; };
+
+    std::printf("\n=== Interactive Water VR telemetry v%u (pid %u) heartbeat %llu ms ===\n",
+        b.version, b.writerPid, static_cast<unsigned long long>(Load(b.heartbeatMs)));
+    std::printf("monitor   iterations=%llu  it/s=%u  probesInWater=%u\n",
+        static_cast<unsigned long long>(Load(b.iterations)), Load(b.iterationsPerSec), Load(b.probesInWater));
+
+    std::printf("skips    ");
+    for (std::size_t i = 0; i < Telemetry::kSkipReasonCount; ++i) {
+        std::printf(" %s=%llu", Telemetry::SkipReasonName(static_cast<Telemetry::SkipReason>(i)),
+            static_cast<unsigned long long>(Load(b.skips[i])));
+    }
+    std::printf("\n");
+
+    std::printf("ripples   queued=%llu (%.1f/s) merged=%llu dropped=%llu emitted=%llu (%.1f/s) depth=%u\n",
+        static_cast<unsigned long long>(cur.ripplesQueued), rate(prev.ripplesQueued, cur.ripplesQueued),
+        static_cast<unsigned long long>(Load(b.ripplesMerged)), static_cast<unsigned long long>(Load(b.ripplesDropped)),
+        static_cast<unsigned long long>(cur.ripplesEmitted), rate(prev.ripplesEmitted, cur.ripplesEmitted),
+        Load(b.rippleQueueDepth));
+    std::printf("sounds    started=%llu (%.1f/s) rejected=%llu\n",
+        static_cast<unsigned long long>(cur.soundsStarted), rate(prev.soundsStarted, cur.soundsStarted),
+        static_cast<unsigned long long>(Load(b.soundsRejected)));
+    std::printf("tasks     posted=%llu (%.1f/s) coalesced=%llu (%.1f/s)\n",
+        static_cast<unsigned long long>(cur.tasksPosted), rate(prev.tasksPosted, cur.tasksPosted),
+        static_cast<unsigned long long>(cur.tasksCoalesced), rate(prev.tasksCoalesced, cur.tasksCoalesced));
+    std::printf("frame     %.2f ms pressure=%u%% deferred=%llu (%.1f/s) cosmeticThinned=%llu\n",
+        Load(b.frameTimeUs) / 1000.0, Load(b.framePressurePct),
+        static_cast<unsigned long long>(cur.tasksDeferred), rate(prev.tasksDeferred, cur.tasksDeferred),
+        static_cast<unsigned long long>(Load(b.cosmeticThinned)));
+    std::printf("sources   actors=%u actorSplashes=%llu thrown=%u thrownSplashes=%llu projectileImpacts=%llu\n",
+        Load(b.actorsTracked), static_cast<unsigned long long>(Load(b.actorSplashes)), Load(b.thrownObjectsTracked),
+        static_cast<unsigned long long>(Load(b.thrownSplashes)), static_cast<unsigned long long>(Load(b.projectileImpacts)));
+
+    std::printf("stages (us, last/peak)");
+    for (std::size_t i = 0; i < Telemetry::kStageCount; ++i) {
+        std::printf(" %s=%u/%u", Telemetry::StageName(static_cast<Telemetry::Stage>(i)), Load(b.stageLastUs[i]), Load(b.stagePeakUs[i]));
+    }
+    std::printf("\n");
+    std::fflush(stdout);
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+    const char* path = argc > 1 ? argv[1] : nullptr;
+    const Telemetry::Block* block = MapBlock(path);
+    if (!block) {
+        std::fprintf(stderr, "could not map telemetry block (%s)\n", path ? path : Telemetry::kMappingName);
+        return 1;
+    }
+    if (block->magic != Telemetry::kMagic) {
+        std::fprintf(stderr, "telemetry block not initialised yet (is the game running?)\n");
+        return 1;
+    }
+    if (block->version != Telemetry::kVersion || block->size != sizeof(Telemetry::Block)) {
+        std::fprintf(stderr, "telemetry layout mismatch: block v%u/%u bytes, reader v%u/%zu bytes\n",
+            block->version, block->size, Telemetry::kVersion, sizeof(Telemetry::Block));
+        return 1;
+    }
+
+    RateSnapshot prev = TakeRates(*block);
+    auto prevTime = std::chrono::steady_clock::now();
+    for (;;) {
+        std::this_thread::sleep_for(std::chrono::seconds(1));
+        const auto now = std::chrono::steady_clock::now();
+        const RateSnapshot cur = TakeRates(*block);
+        Print(*block, prev, cur, std::chrono::duration<double>(now - prevTime).count());
+        prev = cur;
+        prevTime = now;
+    }
+}
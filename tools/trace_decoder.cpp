@@ -0,0 +1,143 @@
+// trace_decoder.cpp - Converts the plugin's binary event trace to CSV or JSON
+//
+// Usage:
+//   trace_decoder <file.trace> [--json]
+// Reads the ring file (also after a crash: committed events are never torn), orders blocks by
+// sequence and prints one event per line. CSV columns: time_us (since the trace was opened),
+// unix_ms, event, then each field as name=value.
+
+#include "event_trace_format.h"
+
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+#include <vector>
+
+using namespace InteractiveWaterVR;
+
+namespace {
+
+struct BlockRef {
+    std::uint32_t seq;
+    std::uint32_t used;
+    std::uint64_t baseUs;
+    const std::uint8_t* payload;
+};
+
+void PrintEvent(bool json, bool& first, const Trace::FileHeader& fh, std::uint64_t tUs, Trace::EventType type,
+    const std::uint64_t* fields, std::size_t fieldCount) {
+    const std::uint64_t relUs = tUs >= fh.startSteadyUs ? tUs - fh.startSteadyUs : 0;
+    const std::uint64_t unixMs = fh.startUnixMs + relUs / 1000;
+    if (json) {
+        std::printf("%s\n  {\"time_us\":%llu,\"unix_ms\":%llu,\"event\":\"%s\"", first ? "" : ",",
+            static_cast<unsigned long long>(relUs), static_cast<unsigned long long>(unixMs), Trace::EventName(type));
+        for (std::size_t i = 0; i < fieldCount; ++i) {
+            std::printf(",\"%s\":%llu", Trace::FieldName(type, i), static_cast<unsigned long long>(fields[i]));
+        }
+        std::printf("}");
+    } else {
+        std::printf("%llu,%llu,%s", static_cast<unsigned long long>(relUs), static_cast<unsigned long long>(unixMs),
+            Trace::EventName(type));
+        for (std::size_t i = 0; i < fieldCount; ++i) {
+            std::printf(",%s=%llu", Trace::FieldName(type, i), static_cast<unsigned long long>(fields[i]));
+        }
+        std::printf("\n");
+    }
+    first = false;
+}
+
+// Returns the number of events decoded; stops at the first malformed byte
+std::size_t DecodeBlock(const BlockRef& b, bool json, bool& first, const Trace::FileHeader& fh) {
+    const std::uint8_t* p = b.payload;
+    const std::uint8_t* end = b.payload + std::min<std::size_t>(b.used, Trace::kBlockPayload);
+    std::uint64_t t = b.baseUs;
+    std::size_t count = 0;
+    while (p < end) {
+        const auto type = static_cast<Trace::EventType>(*p++);
+        const std::size_t fieldCount = Trace::FieldCount(type);
+        if (fieldCount == 0) break;
+
+        std::uint64_t delta = 0;
+        std::size_t n = Trace::GetVarint(p, end, delta);
+        if (n == 0) break;
+        p += n;
+        t += delta;
+
+        std::uint64_t fields[Trace::kMaxFields] = {};
+        bool ok = true;
+        for (std::size_t i = 0; i < fieldCount && ok; ++i) {
+            n = Trace::GetVarint(p, end, fields[i]);
+            ok = n != 0;
+            p += n;
+        }
+        if (!ok) break;
+        PrintEvent(json, first, fh, t, type, fields, fieldCount);
+        ++count;
+    }
+    return count;
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+    const char* path = nullptr;
+    bool json = false;
+    for (int i = 1; i < argc; ++i) {
+        if (std::strcmp(argv[i], "--json") == 0) json = true;
+        else path = argv[i];
+    }
+    if (!path) {
+        std::fprintf(stderr, "usage: trace_decoder <file.trace> [--json]\n");
+        return 2;
+    }
+
+    std::ifstream in(path, std::ios::binary);
+    if (!in) {
+        std::fprintf(stderr, "could not open %s\n", path);
+        return 1;
+    }
+    const std::vector<std::uint8_t> data((std::istreambuf_iterator<char>(in)), std::istreambuf_iterator<char>());
+
+    Trace::FileHeader fh{};
+    if (data.size() < Trace::kBlockSize) {
+        std::fprintf(stderr, "%s is too small to be a trace file\n", path);
+        return 1;
+    }
+    std::memcpy(&fh, data.data(), sizeof(fh));
+    if (fh.magic != Trace::kMagic) {
+        std::fprintf(stderr, "%s is not a trace file (or was never initialised)\n", path);
+        return 1;
+    }
+    if (fh.version != Trace::kVersion || fh.blockSize != Trace::kBlockSize) {
+        std::fprintf(stderr, "trace format mismatch: file v%u/%u-byte blocks, decoder v%u/%u-byte blocks\n",
+            fh.version, fh.blockSize, Trace::kVersion, Trace::kBlockSize);
+        return 1;
+    }
+
+    // Blocks are read through plain copies of their header fields: the atomics are only for the writer
+    std::vector<BlockRef> blocks;
+    for (std::uint32_t i = 0; i < fh.blockCount; ++i) {
+        const std::size_t off = static_cast<std::size_t>(Trace::kBlockSize) * (1 + i);
+        if (off + Trace::kBlockSize > data.size()) break;
+        std::uint32_t seq = 0, used = 0;
+        std::uint64_t baseUs = 0;
+        std::memcpy(&seq, data.data() + off + offsetof(Trace::BlockHeader, seq), sizeof(seq));
+        std::memcpy(&used, data.data() + off + offsetof(Trace::BlockHeader, used), sizeof(used));
+        std::memcpy(&baseUs, data.data() + off + offsetof(Trace::BlockHeader, baseUs), sizeof(baseUs));
+        if (seq == 0) continue;
+        blocks.push_back(BlockRef{ seq, used, baseUs, data.data() + off + sizeof(Trace::BlockHeader) });
+    }
+    std::sort(blocks.begin(), blocks.end(), [](const BlockRef& a, const BlockRef& b) { return a.seq < b.seq; });
+
+    bool first = true;
+    std::size_t total = 0;
+    if (json) std::printf("[");
+    else std::printf("time_us,unix_ms,event,fields...\n");
+    for (const BlockRef& b : blocks) total += DecodeBlock(b, json, first, fh);
+    if (json) std::printf("\n]\n");
+
+    std::fprintf(stderr, "%zu events in %zu blocks (writer pid %u)\n", total, blocks.size(), fh.writerPid);
+    return 0;
+}
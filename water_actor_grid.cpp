@@ -0,0 +1,485 @@
+// water_actor_grid.cpp - Water interaction for actors near the player
+
+#include "water_actor_grid.h"
+#include "water_state.h"
+#include "water_utils.h"
+#include "water_ripple.h"
+#include "water_sound.h"
+#include "helper.h"
+#include "config.h"
+#include "telemetry.h"
+#include "main_thread_tasks.h"
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <limits>
+
+namespace InteractiveWaterVR {
+
+// ============================================================================
+// Constants
+// ============================================================================
+
+namespace {
+
+constexpr std::size_t kMaxTrackedActors = 64;
+constexpr std::size_t kMaxActorProbes = 4;
+// Per-probe state slot of the actor root; kept apart from the limb slots so a tier change never
+// diffs the root against a foot position
+constexpr std::size_t kRootProbe = kMaxActorProbes;
+constexpr std::size_t kProbeSlots = kMaxActorProbes + 1;
+
+// Uniform grid centred on the player's cell; 16 x 512 units covers the maximum tracking range
+constexpr float kGridCellSize = 512.0f;
+constexpr int kGridDim = 16;
+constexpr int kGridCells = kGridDim * kGridDim;
+constexpr float kMaxGridRange = kGridCellSize * (kGridDim / 2);
+
+// How often the pool is reconciled against the process lists
+constexpr long long kMembershipRefreshMs = 500;
+// Per-actor throttles so a crowd stepping into a river does not machine-gun the same sound
+constexpr long long kActorSplashCooldownMs = 250;
+// Horizontal speed (units/s) above which a wading probe leaves a wake
+constexpr float kActorWakeSpeed = 40.0f;
+
+// Feet first so lower LOD tiers keep the probes that actually touch water
+static const char* const kActorProbeNodes[kMaxActorProbes] = {
+    "NPC R Foot [Rft ]",
+    "NPC L Foot [Lft ]",
+    "NPC R Hand [RHnd]",
+    "NPC L Hand [LHnd]"
+};
+
+struct LodTier {
+    float maxDistance;
+    std::size_t probeCount;
+    long long intervalMs;
+};
+
+// The last tier probes only the actor root (creatures, far NPCs)
+constexpr LodTier kLodTiers[] = {
+    { 1024.0f, 4, 16 },
+    { 2048.0f, 2, 50 },
+    { std::numeric_limits<float>::max(), 1, 150 },
+};
+constexpr std::size_t kRootOnlyTier = std::size(kLodTiers) - 1;
+
+constexpr std::int16_t kNoSlot = -1;
+
+// ============================================================================
+// Actor pool
+// ============================================================================
+
+struct ActorSlot {
+    bool active = false;
+    bool seen = false;
+    RE::ActorHandle handle;
+    RE::NiAVObject* resolvedRoot = nullptr;
+    RE::NiPointer<RE::NiAVObject> nodes[kMaxActorProbes];
+
+    bool hasLast[kProbeSlots] = {};
+    bool inWater[kProbeSlots] = {};
+    RE::NiPoint3 lastPos[kProbeSlots];
+
+    long long lastProbeMs = 0;
+    long long nextProbeMs = 0;
+    long long lastSplashMs = 0;
+    std::size_t lod = kRootOnlyTier;
+    float distance = 0.0f;
+
+    int cell = -1;
+    std::int16_t prevInCell = kNoSlot;
+    std::int16_t nextInCell = kNoSlot;
+};
+
+std::array<ActorSlot, kMaxTrackedActors> s_slots{};
+std::array<std::int16_t, kGridCells> s_cellHead{};
+int s_gridOriginX = 0;  // world cell coordinates of grid cell (0,0)
+int s_gridOriginY = 0;
+bool s_gridValid = false;
+long long s_lastMembershipMs = 0;
+
+// Cell indices ordered by ring distance from the grid centre (nearest first)
+std::array<int, kGridCells> s_ringOrder{};
+bool s_ringOrderBuilt = false;
+
+std::atomic<bool> s_updatePending{ false };
+std::atomic<std::uint32_t> s_statTracked{ 0 };
+std::atomic<std::uint32_t> s_statProbed{ 0 };
+std::atomic<std::uint32_t> s_statDeferred{ 0 };
+std::atomic<std::uint64_t> s_statSplashes{ 0 };
+
+long long ActorNowMs() {
+    return std::chrono::duration_cast<std::chrono::milliseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+int WorldCellCoord(float v) {
+    return static_cast<int>(std::floor(v / kGridCellSize));
+}
+
+void BuildRingOrder() {
+    constexpr int c = kGridDim / 2;
+    std::size_t n = 0;
+    for (int ring = 0; ring <= c; ++ring) {
+        for (int y = 0; y < kGridDim; ++y) {
+            for (int x = 0; x < kGridDim; ++x) {
+                if (std::max(std::abs(x - c), std::abs(y - c)) == ring) {
+                    s_ringOrder[n++] = y * kGridDim + x;
+                }
+            }
+        }
+    }
+    s_ringOrderBuilt = true;
+}
+
+// ============================================================================
+// Grid maintenance
+// ============================================================================
+
+void UnlinkFromCell(std::int16_t idx) {
+    ActorSlot& s = s_slots[idx];
+    if (s.cell < 0) return;
+    if (s.prevInCell != kNoSlot) {
+        s_slots[s.prevInCell].nextInCell = s.nextInCell;
+    } else {
+        s_cellHead[s.cell] = s.nextInCell;
+    }
+    if (s.nextInCell != kNoSlot) {
+        s_slots[s.nextInCell].prevInCell = s.prevInCell;
+    }
+    s.cell = -1;
+    s.prevInCell = kNoSlot;
+    s.nextInCell = kNoSlot;
+}
+
+void LinkToCell(std::int16_t idx, int cell) {
+    ActorSlot& s = s_slots[idx];
+    s.cell = cell;
+    s.prevInCell = kNoSlot;
+    s.nextInCell = s_cellHead[cell];
+    if (s.nextInCell != kNoSlot) {
+        s_slots[s.nextInCell].prevInCell = idx;
+    }
+    s_cellHead[cell] = idx;
+}
+
+int GridCellFor(const RE::NiPoint3& p) {
+    const int gx = WorldCellCoord(p.x) - s_gridOriginX;
+    const int gy = WorldCellCoord(p.y) - s_gridOriginY;
+    if (gx < 0 || gy < 0 || gx >= kGridDim || gy >= kGridDim) return -1;
+    return gy * kGridDim + gx;
+}
+
+// Move an actor between cell lists only when its cell actually changed
+void RebinSlot(std::int16_t idx, const RE::NiPoint3& p) {
+    const int cell = GridCellFor(p);
+    if (cell == s_slots[idx].cell) return;
+    UnlinkFromCell(idx);
+    if (cell >= 0) LinkToCell(idx, cell);
+}
+
+void ReleaseSlot(std::int16_t idx) {
+    UnlinkFromCell(idx);
+    s_slots[idx] = ActorSlot{};
+}
+
+// Re-centre the grid when the player crosses into another cell; every slot is re-binned
+void RecentreGrid(const RE::NiPoint3& playerPos) {
+    const int ox = WorldCellCoord(playerPos.x) - kGridDim / 2;
+    const int oy = WorldCellCoord(playerPos.y) - kGridDim / 2;
+    if (s_gridValid && ox == s_gridOriginX && oy == s_gridOriginY) return;
+
+    s_gridOriginX = ox;
+    s_gridOriginY = oy;
+    s_gridValid = true;
+    s_cellHead.fill(kNoSlot);
+    for (std::size_t i = 0; i < kMaxTrackedActors; ++i) {
+        ActorSlot& s = s_slots[i];
+        s.cell = -1;
+        s.prevInCell = kNoSlot;
+        s.nextInCell = kNoSlot;
+    }
+    for (std::size_t i = 0; i < kMaxTrackedActors; ++i) {
+        ActorSlot& s = s_slots[i];
+        if (!s.active) continue;
+        auto actor = s.handle.get();
+        if (actor) RebinSlot(static_cast<std::int16_t>(i), actor->GetPosition());
+    }
+}
+
+// ============================================================================
+// Pool membership
+// ============================================================================
+
+bool IsActorUsable(RE::Actor* actor) {
+    return actor && !actor->IsPlayerRef() && !actor->IsDisabled() && !actor->IsDead() && actor->Is3DLoaded();
+}
+
+void RefreshMembership(const RE::NiPoint3& playerPos, float range) {
+    auto lists = RE::ProcessLists::GetSingleton();
+    if (!lists) return;
+
+    for (auto& s : s_slots) s.seen = false;
+    const float rangeSq = range * range;
+
+    for (auto& h : lists->highActorHandles) {
+        auto actorPtr = h.get();
+        RE::Actor* actor = actorPtr.get();
+        if (!IsActorUsable(actor)) continue;
+        const RE::NiPoint3 pos = actor->GetPosition();
+        const float dx = pos.x - playerPos.x;
+        const float dy = pos.y - playerPos.y;
+        if (dx * dx + dy * dy > rangeSq) continue;
+
+        std::int16_t freeIdx = kNoSlot;
+        bool found = false;
+        for (std::size_t i = 0; i < kMaxTrackedActors; ++i) {
+            ActorSlot& s = s_slots[i];
+            if (s.active && s.handle == h) {
+                s.seen = true;
+                found = true;
+                break;
+            }
+            if (!s.active && freeIdx == kNoSlot) freeIdx = static_cast<std::int16_t>(i);
+        }
+        if (found || freeIdx == kNoSlot) continue;
+
+        ActorSlot& s = s_slots[freeIdx];
+        s = ActorSlot{};
+        s.active = true;
+        s.seen = true;
+        s.handle = h;
+        RebinSlot(freeIdx, pos);
+    }
+
+    for (std::size_t i = 0; i < kMaxTrackedActors; ++i) {
+        if (s_slots[i].active && !s_slots[i].seen) ReleaseSlot(static_cast<std::int16_t>(i));
+    }
+}
+
+// ============================================================================
+// Probing
+// ============================================================================
+
+void ClearProbeHistory(ActorSlot& s) {
+    for (std::size_t i = 0; i < kProbeSlots; ++i) {
+        s.hasLast[i] = false;
+        s.inWater[i] = false;
+    }
+}
+
+void ResolveActorNodes(ActorSlot& s, RE::NiAVObject* root) {
+    for (std::size_t i = 0; i < kMaxActorProbes; ++i) {
+        s.nodes[i].reset(root ? root->GetObjectByName(kActorProbeNodes[i]) : nullptr);
+    }
+    ClearProbeHistory(s);
+    s.resolvedRoot = root;
+}
+
+// Creatures have no NPC limb bones and the last tier skips them: both probe the root alone
+bool ProbesRootOnly(const ActorSlot& s) {
+    return s.lod == kRootOnlyTier || (s.resolvedRoot && !s.nodes[0]);
+}
+
+// Probes the next ProbeActor call will run. Before the nodes are resolved the tier's count is the
+// best guess; afterwards only limb nodes that actually exist are counted.
+std::size_t PlannedProbeCount(const ActorSlot& s) {
+    if (ProbesRootOnly(s)) return 1;
+    const std::size_t count = kLodTiers[s.lod].probeCount;
+    if (!s.resolvedRoot) return count;
+    std::size_t n = 0;
+    for (std::size_t i = 0; i < count; ++i) {
+        if (s.nodes[i]) ++n;
+    }
+    return n;
+}
+
+void EmitActorSplash(ActorSlot& s, RE::NiAVObject* node, const RE::NiPoint3& surfacePoint, float speed, bool entry, long long nowMs) {
+    const float amt = (entry ? ComputeEntrySplashAmount(speed) : ComputeExitSplashAmount(speed)) * cfgActorSplashScale;
+    if (amt <= 0.0f) return;
+    EmitRipple(surfacePoint, amt, entry ? RippleSource::Entry : RippleSource::Exit);
+    s_statSplashes.fetch_add(1);
+
+    if (entry && node && nowMs - s.lastSplashMs >= kActorSplashCooldownMs) {
+        PlayEntrySplashAtNode(node, speed, cfgActorSplashVolume);
+        s.lastSplashMs = nowMs;
+    }
+}
+
+// Returns the number of probes run
+std::size_t ProbeActor(ActorSlot& s, RE::Actor* actor, long long nowMs) {
+    RE::NiAVObject* root = actor->Get3D();
+    if (!root) return 0;
+    if (root != s.resolvedRoot) ResolveActorNodes(s, root);
+
+    const float dt = s.lastProbeMs > 0 ? static_cast<float>(nowMs - s.lastProbeMs) / 1000.0f : 0.0f;
+    s.lastProbeMs = nowMs;
+
+    const bool rootOnly = ProbesRootOnly(s);
+    const std::size_t count = rootOnly ? 1 : kLodTiers[s.lod].probeCount;
+
+    std::size_t probed = 0;
+    for (std::size_t p = 0; p < count; ++p) {
+        const std::size_t i = rootOnly ? kRootProbe : p;
+        RE::NiAVObject* node = rootOnly ? root : s.nodes[i].get();
+        if (!node) continue;
+        ++probed;
+
+        const RE::NiPoint3 pos = node->world.translate;
+        WaterQuery q;
+        QueryWater(pos, q);
+
+        if (!s.hasLast[i] || dt <= 1e-4f || !q.hasWater) {
+            s.lastPos[i] = pos;
+            s.inWater[i] = q.inWater;
+            s.hasLast[i] = true;
+            continue;
+        }
+
+        const float vz = (pos.z - s.lastPos[i].z) / dt;
+        const float dx = pos.x - s.lastPos[i].x;
+        const float dy = pos.y - s.lastPos[i].y;
+        const float horizSpeed = std::sqrt(dx * dx + dy * dy) / dt;
+        const RE::NiPoint3 surfacePoint{ pos.x, pos.y, q.surfaceZ };
+
+        if (q.inWater && !s.inWater[i]) {
+            const float downSpeed = std::max(0.0f, -vz);
+            if (downSpeed >= cfgEntryDownZThreshold && downSpeed <= kMaxEntryDownSpeed) {
+                EmitActorSplash(s, node, surfacePoint, downSpeed, true, nowMs);
+            }
+        } else if (!q.inWater && s.inWater[i]) {
+            const float upSpeed = std::max(0.0f, vz);
+            if (upSpeed >= cfgExitUpZThreshold && upSpeed <= kMaxExitUpSpeed) {
+                EmitActorSplash(s, node, surfacePoint, upSpeed, false, nowMs);
+            }
+        } else if (q.inWater && cfgWakeEnabled && horizSpeed > kActorWakeSpeed) {
+            // Wading or swimming: queued wakes merge in the ripple accumulator
+            const float mult = std::clamp(horizSpeed * cfgWakeScaleMultiplier, cfgWakeMinMultiplier, cfgWakeMaxMultiplier);
+            QueueRipple(RippleSource::Wake, surfacePoint, cfgWakeAmt * mult * cfgActorSplashScale);
+        }
+
+        s.lastPos[i] = pos;
+        s.inWater[i] = q.inWater;
+    }
+    return probed;
+}
+
+std::size_t LodForDistance(float distance) {
+    for (std::size_t t = 0; t < std::size(kLodTiers); ++t) {
+        if (distance <= kLodTiers[t].maxDistance) return t;
+    }
+    return kRootOnlyTier;
+}
+
+}  // namespace
+
+// ============================================================================
+// Public API
+// ============================================================================
+
+void RequestActorWaterUpdate() {
+    if (!cfgActorWaterEnabled) return;
+    if (s_updatePending.exchange(true)) {
+        TelemetryAdd(TelemetryBlock().tasksCoalesced);
+        return;
+    }
+    if (!PostTask(TaskType::ActorUpdate, []() {
+        s_updatePending.store(false);
+        UpdateNearbyActorWater();
+    }, []() { s_updatePending.store(false); })) {
+        s_updatePending.store(false);
+    }
+}
+
+void UpdateNearbyActorWater() {
+    TelemetryStageTimer stageTimer(Telemetry::Stage::ActorUpdate);
+    if (!cfgActorWaterEnabled || g_suspendAllDetections.load() || g_gameLoadInProgress.load()) return;
+
+    auto player = RE::PlayerCharacter::GetSingleton();
+    if (!player) return;
+    const RE::NiPoint3 playerPos = player->GetPosition();
+    const long long nowMs = ActorNowMs();
+    const float range = std::clamp(cfgActorRange, kGridCellSize, kMaxGridRange);
+
+    if (!s_ringOrderBuilt) BuildRingOrder();
+    RecentreGrid(playerPos);
+
+    if (nowMs - s_lastMembershipMs >= kMembershipRefreshMs) {
+        RefreshMembership(playerPos, range);
+        s_lastMembershipMs = nowMs;
+    }
+
+    // Incremental rebin + LOD; unusable actors leave the pool immediately
+    std::uint32_t tracked = 0;
+    for (std::size_t i = 0; i < kMaxTrackedActors; ++i) {
+        ActorSlot& s = s_slots[i];
+        if (!s.active) continue;
+        auto actorPtr = s.handle.get();
+        RE::Actor* actor = actorPtr.get();
+        if (!IsActorUsable(actor)) {
+            ReleaseSlot(static_cast<std::int16_t>(i));
+            continue;
+        }
+        const RE::NiPoint3 pos = actor->GetPosition();
+        RebinSlot(static_cast<std::int16_t>(i), pos);
+        s.distance = std::sqrt((pos.x - playerPos.x) * (pos.x - playerPos.x) + (pos.y - playerPos.y) * (pos.y - playerPos.y));
+        const std::size_t lod = LodForDistance(s.distance);
+        if (lod != s.lod) {
+            // Probes dropped by the old tier carry positions from before it; a returning probe
+            // must start from a fresh sample instead of turning the gap into velocity
+            ClearProbeHistory(s);
+            s.lod = lod;
+        }
+        ++tracked;
+    }
+
+    // Probe nearest rings first until the budget is spent; skipped actors stay due for next tick
+    int budget = std::max(1, cfgActorProbeBudget);
+    std::uint32_t probed = 0;
+    std::uint32_t deferred = 0;
+    for (int cell : s_ringOrder) {
+        for (std::int16_t idx = s_cellHead[cell]; idx != kNoSlot; idx = s_slots[idx].nextInCell) {
+            ActorSlot& s = s_slots[idx];
+            if (nowMs < s.nextProbeMs) continue;
+            const int cost = static_cast<int>(PlannedProbeCount(s));
+            if (cost > budget) {
+                ++deferred;
+                continue;
+            }
+            auto actorPtr = s.handle.get();
+            if (!actorPtr) continue;
+            const std::size_t n = ProbeActor(s, actorPtr.get(), nowMs);
+            budget -= static_cast<int>(n);
+            probed += static_cast<std::uint32_t>(n);
+            s.nextProbeMs = nowMs + kLodTiers[s.lod].intervalMs;
+        }
+    }
+
+    s_statTracked.store(tracked);
+    s_statProbed.store(probed);
+    s_statDeferred.store(deferred);
+}
+
+void ResetActorWaterState() {
+    for (auto& s : s_slots) s = ActorSlot{};
+    s_cellHead.fill(kNoSlot);
+    s_gridValid = false;
+    s_lastMembershipMs = 0;
+    s_statTracked.store(0);
+    s_statProbed.store(0);
+    s_statDeferred.store(0);
+}
+
+ActorWaterStats GetActorWaterStats() {
+    ActorWaterStats st;
+    st.tracked = s_statTracked.load();
+    st.probed = s_statProbed.load();
+    st.deferred = s_statDeferred.load();
+    st.splashes = s_statSplashes.load();
+    return st;
+}
+
+} // namespace InteractiveWaterVR
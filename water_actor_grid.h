@@ -0,0 +1,36 @@
+#pragma once
+// water_actor_grid.h - Water interaction for actors near the player
+
+#include <RE/Skyrim.h>
+#include <cstddef>
+#include <cstdint>
+
+namespace InteractiveWaterVR {
+
+// ============================================================================
+// Nearby actor water interaction
+// ============================================================================
+
+// High-process actors around the player are binned into a uniform grid centred on the player's
+// cell. Actors are probed nearest ring first, with fewer probes and a lower rate further out
+// (hands+feet, feet only, root only), until the per-tick probe budget is spent.
+
+struct ActorWaterStats {
+    std::uint32_t tracked = 0;       // actors currently in the pool
+    std::uint32_t probed = 0;        // probes run in the last update
+    std::uint32_t deferred = 0;      // due actors left for the next update because the budget ran out
+    std::uint64_t splashes = 0;      // lifetime entry/exit ripples emitted for actors
+};
+
+// Monitoring thread: post one coalesced main-thread update if none is outstanding
+void RequestActorWaterUpdate();
+
+// Main thread: refresh the pool/grid and run this tick's probes
+void UpdateNearbyActorWater();
+
+// Drop every tracked actor (game load / state reset)
+void ResetActorWaterState();
+
+ActorWaterStats GetActorWaterStats();
+
+} // namespace InteractiveWaterVR
@@ -4,10 +4,22 @@
 #include "water_utils.h"
 #include "water_sound.h"
 #include "water_ripple.h"
+#include "water_hand_probe.h"
+#include "water_foot_probe.h"
+#include "water_wake_trail.h"
+#include "water_stroke.h"
+#include "water_actor_grid.h"
+#include "water_thrown_objects.h"
+#include "water_projectiles.h"
+#include "water_higgs_velocity.h"
+#include "telemetry.h"
+#include "event_trace.h"
+#include "main_thread_tasks.h"
 #include "helper.h"
 #include "config.h"
 #include "equipped_spell_interaction.h"
-#include <thread>
+#include "worker_runtime.h"
+#include "water_suspend.h"
 #include <chrono>
 #include <atomic>
 #include <SKSE/SKSE.h>
@@ -15,7 +27,8 @@
 #include <cmath>
 #include <algorithm>
 #include <functional>
-#include <deque>
+#include <array>
+#include <memory>
 #include <string>
 #include <vector>
 
@@ -42,9 +55,19 @@ std::atomic<float> s_rightControllerWorldX{0.0f};
 std::atomic<float> s_rightControllerWorldY{0.0f};
 
 // Public API
-void NotifyGameLoadStart() { g_gameLoadInProgress.store(true); }
-void NotifyGameLoadEnd() { g_gameLoadInProgress.store(false); }
+void NotifyGameLoadStart() {
+    g_gameLoadInProgress.store(true);
+    SetMonitorSuspended(MonitorSuspendSource::GameLoad, true);
+}
+void NotifyGameLoadEnd() {
+    g_gameLoadInProgress.store(false);
+    SetMonitorSuspended(MonitorSuspendSource::GameLoad, false);
+}
 bool IsGameLoadInProgress() { return g_gameLoadInProgress.load(); }
+void MarkGameLoadFinished() {
+    g_loadFinishedMs.store(std::chrono::duration_cast<std::chrono::milliseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count());
+}
 void ClearCachedForms() { ResetAllWaterState(); }
 void StartLeftWaterDetection() { g_leftDetectionActive.store(true); }
 void StopLeftWaterDetection() { g_leftDetectionActive.store(false); }
@@ -53,6 +76,12 @@ void StopRightWaterDetection() { g_rightDetectionActive.store(false); }
 bool IsLeftWaterDetectionActive() { return g_leftDetectionActive.load(); }
 bool IsRightWaterDetectionActive() { return g_rightDetectionActive.load(); }
 
+// Set when the monitor resumes from a suspension or the player was moved (fast travel, cell change);
+// the next tick starts over from fresh samples
+static std::atomic<bool> s_resetMonitorHistory{false};
+
+void ResetWaterMonitorHistory() { s_resetMonitorHistory.store(true, std::memory_order_release); }
+
 static std::string GatherSpellEffectKeywords(RE::MagicItem* spell) {
     if (!spell) return {};
     std::vector<std::string> kwNames;
@@ -79,14 +108,21 @@ for (size_t i = 0; i < kwNames.size(); ++i) {
 return joined;
 }
 
-static void MonitoringThread() {
-    loadConfig();
+// Everything the monitor keeps from one tick to the next. The runtime calls Tick on a worker on a
+// fixed-rate grid of [Performance] PollIntervalMs; while a pausing menu, a loading screen or a game
+// load is up the whole runtime is parked (water_suspend.h) and no tick runs. The tick reads this
+// state as plain names.
+struct MonitorContext {
+    MonitorContext();
+    JobDelay Tick();
 
-    // CRITICAL: Ensure detection is enabled at thread start
-    g_leftDetectionActive.store(true);
-    g_rightDetectionActive.store(true);
-    g_suspendAllDetections.store(false);
-    IW_LOG_INFO("MonitoringThread: started, detection enabled for both hands");
+    // Forget every sample taken before a suspension or teleport: filters, velocity history, probes,
+    // trails and strokes start over, and the next tick re-reads the hands' water contact without
+    // treating it as an entry or exit
+    void ResetHistory();
+
+    // Every path out of a tick, early or not, asks for the same next deadline
+    static JobDelay TickPeriod() { return std::chrono::milliseconds(cfgPollIntervalMs); }
 
     bool lastLeftInWater = false;
     bool lastRightInWater = false;
@@ -95,18 +131,42 @@ static void MonitoringThread() {
     bool spellMonitorActive = false;
     bool loggedLeftNodeAvailable = false;
     bool loggedRightNodeAvailable = false;
-
-    RE::NiPoint3 prevLeftPos{0.0f, 0.0f, 0.0f};
-    RE::NiPoint3 prevRightPos{0.0f, 0.0f, 0.0f};
-
-    std::deque<Sample> leftSamples;
-    std::deque<Sample> rightSamples;
-    std::deque<Sample> playerSamples;
+    bool reseedWaterContact = false;
+
+    // Per-hand filtered motion: every movement, wake and splash speed below reads this one state
+    MotionFilter leftFilter;
+    MotionFilter rightFilter;
+    MovementDetector leftMovement;
+    MovementDetector rightMovement;
+
+    // Hand + fingertip probes for fingertip-resolution submersion
+    HandProbeSet leftHandProbes;
+    HandProbeSet rightHandProbes;
+
+    // Foot probes, only active while the player is wading
+    FootProbe leftFootProbe;
+    FootProbe rightFootProbe;
+    bool footProbesActive = false;
+
+    // Wake trails: filtered hand path since the last wake ripple
+    WakeTrail leftWakeTrail;
+    WakeTrail rightWakeTrail;
+
+    // Swim stroke cycles per hand, only fed while the player swims
+    StrokeRecognizer leftStroke;
+    StrokeRecognizer rightStroke;
+    std::chrono::steady_clock::time_point prevFootTime = std::chrono::steady_clock::now();
+    long long lastFootSplashMs[2] = { 0, 0 };
+
+    // Recent player positions in a fixed ring (no per-tick allocation); the newest two give the velocity
+    static constexpr std::size_t kPlayerSampleRing = 8;
+    std::array<Sample, kPlayerSampleRing> playerSamples{};
+    std::size_t playerSampleCount = 0;  // samples pushed; the newest is at (count - 1) % ring
 
     float prevLeftWaterHeight = 0.0f;
 float prevRightWaterHeight = 0.0f;
-    auto prevLeftTime = std::chrono::steady_clock::now();
-    auto prevRightTime = prevLeftTime;
+    std::chrono::steady_clock::time_point prevLeftTime = std::chrono::steady_clock::now();
+    std::chrono::steady_clock::time_point prevRightTime = prevLeftTime;
     bool havePrevLeft = false;
     bool havePrevRight = false;
 
@@ -116,11 +176,7 @@ float prevRightWaterHeight = 0.0f;
     float recentLeftSpeed = 0.0f;
     float recentRightSpeed = 0.0f;
     float recentPlayerSpeed = 0.0f;
-
-    auto leftLastMovementTime = std::chrono::steady_clock::now();
-    auto rightLastMovementTime = std::chrono::steady_clock::now();
-    std::chrono::steady_clock::time_point leftMovementCandidateTime{};
-    std::chrono::steady_clock::time_point rightMovementCandidateTime{};
+    RE::NiPoint3 recentPlayerVel{ 0.0f, 0.0f, 0.0f };
 
     // Diagnostic: track iterations and log periodically
     int iterationCount = 0;
@@ -133,49 +189,90 @@ float prevRightWaterHeight = 0.0f;
     int skipGameLoad = 0;
     int skipNoNodes = 0;
     int skipNoWaterType = 0;
-    int skipFastTravel = 0;
     int skipDeepWater = 0;
     int skipSneakDepth = 0;
-    auto lastDiagLogTime = std::chrono::steady_clock::now();
+    std::chrono::steady_clock::time_point lastDiagLogTime = std::chrono::steady_clock::now();
+    std::chrono::steady_clock::time_point lastTelemetryPublish = lastDiagLogTime;
+};
 
-    while (g_running.load(std::memory_order_acquire)) {
+MonitorContext::MonitorContext() {
+    loadConfig();
+
+    // CRITICAL: Ensure detection is enabled at monitor start
+    g_leftDetectionActive.store(true);
+    g_rightDetectionActive.store(true);
+    if (g_suspendAllDetections.exchange(false)) TraceSuspension(false, Trace::SuspendReason::Reset);
+    IW_LOG_INFO("MonitoringThread: started, detection enabled for both hands");
+}
+
+void MonitorContext::ResetHistory() {
+    const auto now = std::chrono::steady_clock::now();
+    leftFilter.Reset();
+    rightFilter.Reset();
+    leftMovement.Reset();
+    rightMovement.Reset();
+    leftHandProbes.Reset();
+    rightHandProbes.Reset();
+    leftFootProbe.Reset();
+    rightFootProbe.Reset();
+    footProbesActive = false;
+    leftWakeTrail.Reset();
+    rightWakeTrail.Reset();
+    leftStroke.Reset();
+    rightStroke.Reset();
+    playerSampleCount = 0;
+    havePrevLeft = false;
+    havePrevRight = false;
+    prevLeftTime = now;
+    prevRightTime = now;
+    prevFootTime = now;
+    leftMoving = false;
+    rightMoving = false;
+    recentLeftSpeed = 0.0f;
+    recentRightSpeed = 0.0f;
+    recentPlayerSpeed = 0.0f;
+    recentPlayerVel = RE::NiPoint3{ 0.0f, 0.0f, 0.0f };
+    reseedWaterContact = true;
+}
+
+JobDelay MonitorContext::Tick() {
+    if (!g_running.load(std::memory_order_acquire)) return kJobDone;
+    if (s_resetMonitorHistory.exchange(false, std::memory_order_acq_rel)) ResetHistory();
         try {
-   loadConfig();
+   ReloadConfigIfChanged();
          iterationCount++;
+            const auto tickStart = std::chrono::steady_clock::now();
+            TelemetryAdd(TelemetryBlock().iterations);
+            if (tickStart - lastTelemetryPublish >= std::chrono::seconds(1)) {
+                PublishTelemetry();
+                lastTelemetryPublish = tickStart;
+            }
 
       auto player = RE::PlayerCharacter::GetSingleton();
             if (!player) {
     skipNoPlayer++;
-       std::this_thread::sleep_for(std::chrono::milliseconds(kPollIntervalMs));
-     continue;
+    TelemetrySkip(Telemetry::SkipReason::NoPlayer);
+     return TickPeriod();
           }
             auto root = player->Get3D();
             if (!root) {
                 skipNoRoot++;
-       std::this_thread::sleep_for(std::chrono::milliseconds(kPollIntervalMs));
-         continue;
+                TelemetrySkip(Telemetry::SkipReason::NoRoot);
+         return TickPeriod();
             }
 
             if (g_gameLoadInProgress.load()) {
          skipGameLoad++;
-      std::this_thread::sleep_for(std::chrono::milliseconds(kPollIntervalMs));
-           continue;
+         TelemetrySkip(Telemetry::SkipReason::GameLoad);
+           return TickPeriod();
       }
 
-        auto ui = RE::UI::GetSingleton();
-            if (ui) {
-                while (g_running.load(std::memory_order_acquire) && (ui->GameIsPaused() || ui->IsShowingMenus())) {
-   std::this_thread::sleep_for(std::chrono::milliseconds(25));
-        ui = RE::UI::GetSingleton();
-                }
-      if (!g_running.load(std::memory_order_acquire)) break;
-            }
-
         auto leftNode = GetPlayerHandNode(false);
             auto rightNode = GetPlayerHandNode(true);
 
   if (!leftNode) {
-        leftSamples.clear();
+        leftFilter.Reset();
+        leftHandProbes.Reset();
     havePrevLeft = false;
          loggedLeftNodeAvailable = false;
             } else if (!loggedLeftNodeAvailable) {
@@ -184,7 +281,8 @@ float prevRightWaterHeight = 0.0f;
    }
 
          if (!rightNode) {
-          rightSamples.clear();
+          rightFilter.Reset();
+          rightHandProbes.Reset();
      havePrevRight = false;
      loggedRightNodeAvailable = false;
             } else if (!loggedRightNodeAvailable) {
@@ -194,26 +292,51 @@ float prevRightWaterHeight = 0.0f;
 
    if (!leftNode && !rightNode) {
           skipNoNodes++;
-                std::this_thread::sleep_for(std::chrono::milliseconds(kPollIntervalMs));
-       continue;
+          TelemetrySkip(Telemetry::SkipReason::NoNodes);
+       return TickPeriod();
       }
 
        // Log diagnostic info every 10 seconds
       auto secsSinceLastDiag = std::chrono::duration<float>(std::chrono::steady_clock::now() - lastDiagLogTime).count();
   if (secsSinceLastDiag >= 10.0f) {
        if (skipNoPlayer > 0 || skipNoRoot > 0 || skipGameLoad > 0 || skipNoNodes > 0 || 
-     skipNoWaterType > 0 || skipFastTravel > 0 || skipDeepWater > 0 || skipSneakDepth > 0) {
-      IW_LOG_INFO("MonitoringThread diagnostics: iter=%d, skips: noPlayer=%d noRoot=%d gameLoad=%d noNodes=%d noWaterType=%d fastTravel=%d deepWater=%d sneakDepth=%d",
+     skipNoWaterType > 0 || skipDeepWater > 0 || skipSneakDepth > 0) {
+      IW_LOG_INFO("MonitoringThread diagnostics: iter=%d, skips: noPlayer=%d noRoot=%d gameLoad=%d noNodes=%d noWaterType=%d deepWater=%d sneakDepth=%d",
       iterationCount, skipNoPlayer, skipNoRoot, skipGameLoad, skipNoNodes, 
-    skipNoWaterType, skipFastTravel, skipDeepWater, skipSneakDepth);
+    skipNoWaterType, skipDeepWater, skipSneakDepth);
    }
+            {
+                RippleCounters rc = GetRippleCounters();
+                if (rc.queued > 0) {
+                    IW_LOG_INFO("Ripple accumulator: queued=%llu merged=%llu dropped=%llu emitted=%llu",
+                        static_cast<unsigned long long>(rc.queued), static_cast<unsigned long long>(rc.merged),
+                        static_cast<unsigned long long>(rc.dropped), static_cast<unsigned long long>(rc.emitted));
+                }
+                ActorWaterStats as = GetActorWaterStats();
+                if (as.tracked > 0) {
+                    IW_LOG_INFO("Nearby actors: tracked=%u probed=%u deferred=%u splashes=%llu",
+                        as.tracked, as.probed, as.deferred, static_cast<unsigned long long>(as.splashes));
+                }
+                ThrownObjectStats ts = GetThrownObjectStats();
+                if (ts.tracked > 0 || ts.splashes > 0) {
+                    IW_LOG_INFO("Thrown objects: tracked=%u splashes=%llu poolFull=%llu",
+                        ts.tracked, static_cast<unsigned long long>(ts.splashes), static_cast<unsigned long long>(ts.dropped));
+                }
+                LogTaskStats();
+                LogJobStats();
+                ProjectileWaterStats ps = GetProjectileWaterStats();
+                if (ps.scanned > 0) {
+                    IW_LOG_INFO("Projectiles: scanned=%llu impacts=%llu deferredByCap=%llu",
+                        static_cast<unsigned long long>(ps.scanned), static_cast<unsigned long long>(ps.crossings),
+                        static_cast<unsigned long long>(ps.capped));
+                }
+            }
        // Reset counters
         skipNoPlayer = 0;
         skipNoRoot = 0;
      skipGameLoad = 0;
        skipNoNodes = 0;
         skipNoWaterType = 0;
-         skipFastTravel = 0;
    skipDeepWater = 0;
    skipSneakDepth = 0;
           lastDiagLogTime = std::chrono::steady_clock::now();
@@ -223,6 +346,12 @@ float prevRightWaterHeight = 0.0f;
    if (!loggedFirstSuccessfulIteration) {
                 IW_LOG_INFO("MonitoringThread: first successful iteration - detection is now active");
   loggedFirstSuccessfulIteration = true;
+                long long loadMs = g_loadFinishedMs.exchange(0);
+                if (loadMs != 0) {
+                    long long nowMs = std::chrono::duration_cast<std::chrono::milliseconds>(
+                        std::chrono::steady_clock::now().time_since_epoch()).count();
+                    IW_LOG_INFO("MonitoringThread: time to first detection after load: %lld ms", nowMs - loadMs);
+                }
             }
 
             auto leftPos = leftNode ? leftNode->world.translate : RE::NiPoint3{0.0f, 0.0f, 0.0f};
@@ -243,11 +372,20 @@ float prevRightWaterHeight = 0.0f;
    else IW_LOG_INFO("Player stopped sneaking");
             }
 
+            auto actorState = player->AsActorState();
+            const bool swimming = actorState && actorState->IsSwimming();
+            if (swimming != g_prevPlayerSwimming.load()) {
+                g_prevPlayerSwimming.store(swimming);
+                IW_LOG_INFO("Player %s swimming (strokes so far: left=%u right=%u)", swimming ? "started" : "stopped",
+                    leftStroke.Strokes(), rightStroke.Strokes());
+            }
+
      float playerDepth = 0.0f;
+            // Kept for the foot probes: they test against this plane instead of querying again
+            WaterQuery playerWater;
   {
-      float wh = 0.0f;
-       if (IsPointInWater(playerPos, wh)) {
-           playerDepth = wh - playerPos.z;
+       if (QueryWater(playerPos, playerWater)) {
+           playerDepth = playerWater.surfaceZ - playerPos.z;
      if (playerDepth < 0.0f) playerDepth = 0.0f;
  }
      }
@@ -265,137 +403,81 @@ float prevRightWaterHeight = 0.0f;
  if (!g_suspendAllDetections.load()) {
      g_suspendDueToDepthSneak.store(false);
          g_suspendAllDetections.store(true);
+         TraceSuspension(true, Trace::SuspendReason::DeepWater);
         }
       skipDeepWater++;
-      std::this_thread::sleep_for(std::chrono::milliseconds(kPollIntervalMs));
-      continue;
+      TelemetrySkip(Telemetry::SkipReason::DeepWater);
+      return TickPeriod();
           }
 
   if (g_suspendAllDetections.load() && playerDepth < kPlayerDepthShutdownMeters && !g_suspendDueToDepthSneak.load()) {
     g_suspendAllDetections.store(false);
+    TraceSuspension(false, Trace::SuspendReason::DeepWater);
       }
 
        if (playerDepth >= kPlayerDepthSneakShutdownMeters && curSneaking) {
             if (!g_suspendAllDetections.load()) {
     g_suspendAllDetections.store(true);
       g_suspendDueToDepthSneak.store(true);
+      TraceSuspension(true, Trace::SuspendReason::SneakDepth);
    }
       skipSneakDepth++;
-       std::this_thread::sleep_for(std::chrono::milliseconds(kPollIntervalMs));
-  continue;
+      TelemetrySkip(Telemetry::SkipReason::SneakDepth);
+  return TickPeriod();
 }
 
             if (g_suspendDueToDepthSneak.load() && (playerDepth < kPlayerDepthSneakShutdownMeters || !curSneaking)) {
   g_suspendDueToDepthSneak.store(false);
           g_suspendAllDetections.store(false);
+          TraceSuspension(false, Trace::SuspendReason::SneakDepth);
    }
 
-       RE::NiPoint3 leftForward = GetControllerForward(false);
-            RE::NiPoint3 rightForward = GetControllerForward(true);
           auto sampleTime = std::chrono::steady_clock::now();
-   leftSamples.push_back(Sample{leftPos, leftForward, sampleTime});
-            rightSamples.push_back(Sample{rightPos, rightForward, sampleTime});
-   playerSamples.push_back(Sample{playerPos, RE::NiPoint3{0.0f, 0.0f, 0.0f}, sampleTime});
-
-        constexpr size_t kMaxSamples = 7;
-       if (leftSamples.size() > kMaxSamples) leftSamples.pop_front();
-  if (rightSamples.size() > kMaxSamples) rightSamples.pop_front();
-     if (playerSamples.size() > kMaxSamples) playerSamples.pop_front();
-
- if (playerSamples.size() >= 2) {
-      const auto& sPrev = playerSamples[playerSamples.size() - 2];
-  const auto& sCur = playerSamples[playerSamples.size() - 1];
+   playerSamples[playerSampleCount % kPlayerSampleRing] = Sample{playerPos, RE::NiPoint3{0.0f, 0.0f, 0.0f}, sampleTime};
+            ++playerSampleCount;
+
+ if (playerSampleCount >= 2) {
+      const auto& sPrev = playerSamples[(playerSampleCount - 2) % kPlayerSampleRing];
+  const auto& sCur = playerSamples[(playerSampleCount - 1) % kPlayerSampleRing];
 double ds = std::chrono::duration<double>(sCur.t - sPrev.t).count();
           if (ds > 1e-6) {
      float dx = sCur.pos.x - sPrev.pos.x;
      float dy = sCur.pos.y - sPrev.pos.y;
       float dz = sCur.pos.z - sPrev.pos.z;
            recentPlayerSpeed = std::sqrt(dx * dx + dy * dy + dz * dz) / (float)ds;
-      constexpr float kPlayerSpeedShutdown = 220.0f;
-   if (recentPlayerSpeed > kPlayerSpeedShutdown) {
-            skipFastTravel++;
-  std::this_thread::sleep_for(std::chrono::milliseconds(kPollIntervalMs));
-       continue;
-     }
+           recentPlayerVel = RE::NiPoint3{ dx / (float)ds, dy / (float)ds, dz / (float)ds };
     }
 }
 
-float leftWaterHeight = 0.0f;
-     float rightWaterHeight = 0.0f;
-   bool leftInWater = IsPointInWater(leftPos, leftWaterHeight);
-    bool rightInWater = IsPointInWater(rightPos, rightWaterHeight);
+            // Nearby NPCs/creatures and projectiles run on the main thread under their own budgets
+            RequestActorWaterUpdate();
+            RequestProjectileScan();
+
+            // One water query per hand; the surface height it returns is reused for hover below
+            WaterQuery leftWater;
+            WaterQuery rightWater;
+            {
+                TelemetryStageTimer handWaterTimer(Telemetry::Stage::HandWater);
+                if (leftNode) QueryWater(leftPos, leftWater);
+                if (rightNode) QueryWater(rightPos, rightWater);
+            }
+            float leftWaterHeight = leftWater.surfaceZ;
+            float rightWaterHeight = rightWater.surfaceZ;
+            bool leftInWater = leftWater.inWater;
+            bool rightInWater = rightWater.inWater;
+            if (reseedWaterContact) {
+                lastLeftInWater = leftInWater;
+                lastRightInWater = rightInWater;
+                reseedWaterContact = false;
+            }
 
       auto waterSystemCheck = RE::TESWaterSystem::GetSingleton();
       if (waterSystemCheck && !waterSystemCheck->currentWaterType) {
  skipNoWaterType++;
-   std::this_thread::sleep_for(std::chrono::milliseconds(kPollIntervalMs));
-          continue;
+ TelemetrySkip(Telemetry::SkipReason::NoWaterType);
+          return TickPeriod();
       }
 
-  // Hover detection - check if controller is near water surface (above or slightly below)
-      bool leftHovering = false;
-            bool rightHovering = false;
-float leftHoverHeight = 0.0f;
-      float rightHoverHeight = 0.0f;
-   
-         // For left controller
-         if (leftNode) {
-        float waterHeightAtPos = 0.0f;
-  bool hasWaterBelow = false;
-      
-  if (leftInWater) {
-           // Controller is in water - use the water height we already have
-          waterHeightAtPos = leftWaterHeight;
-                hasWaterBelow = true;
-       } else {
-          // Controller is not in water - check if there's water below
-           RE::NiPoint3 checkPos = leftPos;
-    checkPos.z -= 500.0f;
-    if (IsPointInWater(checkPos, waterHeightAtPos)) {
-            hasWaterBelow = true;
-         }
-        }
-                
-   if (hasWaterBelow) {
-      // Calculate height relative to water surface (positive = above, negative = below)
-       leftHoverHeight = leftPos.z - waterHeightAtPos;
-              // Hovering if within range: slightly below (-tolerance) to max height above
-    if (leftHoverHeight >= -kHoverDetectionBelowTolerance && leftHoverHeight <= kHoverDetectionMaxHeight) {
-leftHovering = true;
-       }
-    }
-      }
-      
-            // For right controller
-    if (rightNode) {
-          float waterHeightAtPos = 0.0f;
-          bool hasWaterBelow = false;
-       
-         if (rightInWater) {
-   waterHeightAtPos = rightWaterHeight;
-    hasWaterBelow = true;
-  } else {
-  RE::NiPoint3 checkPos = rightPos;
-        checkPos.z -= 500.0f;
-   if (IsPointInWater(checkPos, waterHeightAtPos)) {
-           hasWaterBelow = true;
-         }
-          }
-     
-      if (hasWaterBelow) {
-        rightHoverHeight = rightPos.z - waterHeightAtPos;
-                    if (rightHoverHeight >= -kHoverDetectionBelowTolerance && rightHoverHeight <= kHoverDetectionMaxHeight) {
- rightHovering = true;
-   }
-    }
-        }
-      
-       // Update hover state
-       g_leftControllerHoveringAboveWater.store(leftHovering);
- g_rightControllerHoveringAboveWater.store(rightHovering);
-    g_leftControllerHoverHeight.store(leftHoverHeight);
-  g_rightControllerHoverHeight.store(rightHoverHeight);
-
 float leftControllerDepth = 0.0f;
    float rightControllerDepth = 0.0f;
             if (leftInWater) {
@@ -415,64 +497,79 @@ float leftControllerDepth = 0.0f;
    float leftDt = havePrevLeft ? std::chrono::duration<float>(now - prevLeftTime).count() : 0.0f;
         float rightDt = havePrevRight ? std::chrono::duration<float>(now - prevRightTime).count() : 0.0f;
 
-       float movingConfirm = cfgMovingConfirmSeconds;
+            float movingConfirm = cfgMovingConfirmSeconds;
             float movingThreshold = cfgMovingThresholdAdjusted;
-
-          if (havePrevLeft && leftDt > 1e-6f && leftSamples.size() >= 2) {
-            const auto& sPrev = leftSamples[leftSamples.size() - 2];
-       const auto& sCur = leftSamples[leftSamples.size() - 1];
-   double ds = std::chrono::duration<double>(sCur.t - sPrev.t).count();
- if (ds > 1e-6) {
-     float dx = sCur.pos.x - sPrev.pos.x;
-   float dy = sCur.pos.y - sPrev.pos.y;
-  float dz = sCur.pos.z - sPrev.pos.z;
-   float speed = std::sqrt(dx * dx + dy * dy + dz * dz) / (float)ds;
-          if (speed <= kMaxValidSpeed) {
-          recentLeftSpeed = speed;
-         if (speed > movingThreshold) leftLastMovementTime = now;
-       if (!leftMoving && speed > movingThreshold) {
-           if (leftMovementCandidateTime.time_since_epoch().count() == 0) leftMovementCandidateTime = now;
-         else if (std::chrono::duration<float>(now - leftMovementCandidateTime).count() >= movingConfirm) {
-  leftMoving = true;
-        leftMovementCandidateTime = std::chrono::steady_clock::time_point{};
-             }
-      } else if (!leftMoving) {
- leftMovementCandidateTime = std::chrono::steady_clock::time_point{};
-       } else if (std::chrono::duration<float>(now - leftLastMovementTime).count() >= kStationaryConfirmSeconds) {
- leftMoving = false;
-          }
-       }
-}
- }
-
-          if (havePrevRight && rightDt > 1e-6f && rightSamples.size() >= 2) {
-    const auto& sPrev = rightSamples[rightSamples.size() - 2];
-   const auto& sCur = rightSamples[rightSamples.size() - 1];
-       double ds = std::chrono::duration<double>(sCur.t - sPrev.t).count();
-       if (ds > 1e-6) {
-     float dx = sCur.pos.x - sPrev.pos.x;
-             float dy = sCur.pos.y - sPrev.pos.y;
-   float dz = sCur.pos.z - sPrev.pos.z;
-          float speed = std::sqrt(dx * dx + dy * dy + dz * dz) / (float)ds;
-           if (speed <= kMaxValidSpeed) {
-           recentRightSpeed = speed;
-      if (speed > movingThreshold) rightLastMovementTime = now;
-               if (!rightMoving && speed > movingThreshold) {
-     if (rightMovementCandidateTime.time_since_epoch().count() == 0) rightMovementCandidateTime = now;
-       else if (std::chrono::duration<float>(now - rightMovementCandidateTime).count() >= movingConfirm) {
-         rightMoving = true;
-           rightMovementCandidateTime = std::chrono::steady_clock::time_point{};
-         }
-          } else if (!rightMoving) {
-              rightMovementCandidateTime = std::chrono::steady_clock::time_point{};
-            } else if (std::chrono::duration<float>(now - rightLastMovementTime).count() >= kStationaryConfirmSeconds) {
-                    rightMoving = false;
+            const DetectionParams detectionParams = GetDetectionParams();
+            const MotionFilterParams& filterParams = detectionParams.filter;
+
+            // One filter update per hand per tick; speed, velocity and confidence come from the filtered state.
+            // With HIGGS the hand body's own velocity (sampled on the frame that moved it) replaces the
+            // differenced estimate, so it is not tied to this thread's timestamps.
+            MotionState leftMotion;
+            MotionState rightMotion;
+            RE::NiPoint3 bodyVel;
+            if (leftNode) {
+                leftMotion = leftFilter.Update(leftPos.x, leftPos.y, leftPos.z, leftDt, filterParams);
+                if (GetHiggsHandVelocity(true, bodyVel)) {
+                    leftMotion = WithMeasuredVelocity(leftMotion, bodyVel.x, bodyVel.y, bodyVel.z, filterParams);
+                }
+                recentLeftSpeed = leftMotion.valid ? leftMotion.speed : 0.0f;
+                leftMoving = leftMovement.Update(leftMotion, leftDt, movingThreshold, movingConfirm, kStationaryConfirmSeconds);
             }
+            if (rightNode) {
+                rightMotion = rightFilter.Update(rightPos.x, rightPos.y, rightPos.z, rightDt, filterParams);
+                if (GetHiggsHandVelocity(false, bodyVel)) {
+                    rightMotion = WithMeasuredVelocity(rightMotion, bodyVel.x, bodyVel.y, bodyVel.z, filterParams);
                 }
-       }
-   }
+                recentRightSpeed = rightMotion.valid ? rightMotion.speed : 0.0f;
+                rightMoving = rightMovement.Update(rightMotion, rightDt, movingThreshold, movingConfirm, kStationaryConfirmSeconds);
+            }
+            const float leftVelZ = leftMotion.valid ? leftMotion.vel.z : 0.0f;
+            const float rightVelZ = rightMotion.valid ? rightMotion.vel.z : 0.0f;
+
+            // Hover detection - height above the water plane the hand's own query already found,
+            // plus approach speed and predicted time to contact from the filtered vertical velocity
+            HoverState leftHover;
+            HoverState rightHover;
+            if (leftNode) leftHover = ComputeHoverState(leftPos, leftWater, leftVelZ);
+            if (rightNode) rightHover = ComputeHoverState(rightPos, rightWater, rightVelZ);
+            g_leftControllerHoveringAboveWater.store(leftHover.hovering);
+            g_rightControllerHoveringAboveWater.store(rightHover.hovering);
+            g_leftControllerHoverHeight.store(leftHover.height);
+            g_rightControllerHoverHeight.store(rightHover.height);
+            g_leftControllerApproachSpeed.store(leftHover.approachSpeed);
+            g_rightControllerApproachSpeed.store(rightHover.approachSpeed);
+            g_leftControllerTimeToContact.store(leftHover.timeToContact);
+            g_rightControllerTimeToContact.store(rightHover.timeToContact);
+            if (g_leftDetectionActive.load()) PreArmEntrySplash(true);
+            if (g_rightDetectionActive.load()) PreArmEntrySplash(false);
+
+            // Fingertip-resolution submersion against the same water planes
+            const auto& leftSub = leftHandProbes.Update(root, leftNode, true, leftWater.hasWater, leftWaterHeight);
+            const auto& rightSub = rightHandProbes.Update(root, rightNode, false, rightWater.hasWater, rightWaterHeight);
+            g_leftHandSubmergedFraction.store(leftSub.submergedFraction);
+            g_rightHandSubmergedFraction.store(rightSub.submergedFraction);
+
+            // Fingers dipped before the wrist crossed the surface: ripple at the real contact point
+            if (cfgFingertipRippleScale > 0.0f) {
+                auto emitFingertipRipple = [](bool isLeft, const HandSubmersion& sub, float velZ) {
+                    float downSpeed = std::max(0.0f, -velZ);
+                    if (downSpeed < cfgEntryDownZThreshold || downSpeed > kMaxEntryDownSpeed) return;
+                    float amt = ComputeEntrySplashAmount(downSpeed) * cfgFingertipRippleScale;
+                    if (amt <= 0.0f) return;
+                    RE::NiPoint3 contact = sub.contactPoint;
+                    auto taskIntf = SKSE::GetTaskInterface();
+                    if (taskIntf) {
+                        PostTask(TaskType::FingertipRipple, [isLeft, contact, amt]() {
+                            if (g_gameLoadInProgress.load()) return;
+                            EmitRippleIfAllowed(isLeft, contact, amt, false, 0, isLeft ? "left_fingertip" : "right_fingertip");
+                        });
+                    }
+                };
+                if (g_leftDetectionActive.load() && leftSub.newContact && !leftInWater) emitFingertipRipple(true, leftSub, leftVelZ);
+                if (g_rightDetectionActive.load() && rightSub.newContact && !rightInWater) emitFingertipRipple(false, rightSub, rightVelZ);
+            }
 
-            float wakeSpeedThreshold = std::max(0.01f, movingThreshold * 0.5f);
      g_leftIsMoving.store(leftMoving);
             g_rightIsMoving.store(rightMoving);
 
@@ -488,58 +585,184 @@ prevLeftMovingLocal = leftMoving;
       g_leftSuppressDueToSneakDepth.store(curSneaking && leftControllerDepth >= 2.0f);
   g_rightSuppressDueToSneakDepth.store(curSneaking && rightControllerDepth >= 2.0f);
 
+            // Swim strokes: hand velocity relative to the body along the player's heading. A stroke's
+            // wake is laid at its release together with one splash, instead of every few ticks.
+            bool leftStrokeHold = false, rightStrokeHold = false;
+            bool leftStrokeRelease = false, rightStrokeRelease = false;
+            if (cfgStrokeEnabled && swimming) {
+                const float heading = player->data.angle.z;
+                const float fwdX = std::sin(heading);
+                const float fwdY = std::cos(heading);
+                StrokeParams strokeParams;
+                strokeParams.speedThreshold = cfgStrokeSpeedThreshold;
+                auto updateStroke = [&](StrokeRecognizer& stroke, bool isLeft, RE::NiAVObject* node, const MotionState& motion,
+                                        bool inWater, const RE::NiPoint3& handPos, float waterZ, float depth, float dt,
+                                        bool& hold, bool& release) {
+                    if (!node || !motion.valid) {
+                        stroke.Reset();
+                        return;
+                    }
+                    const float forwardSpeed = (motion.vel.x - recentPlayerVel.x) * fwdX + (motion.vel.y - recentPlayerVel.y) * fwdY;
+                    const StrokeEvent& ev = stroke.Update(forwardSpeed, inWater, RE::NiPoint3{ handPos.x, handPos.y, waterZ }, dt, strokeParams);
+                    hold = stroke.InCycle();
+                    release = ev.released;
+                    const bool detectionActive = isLeft ? g_leftDetectionActive.load() : g_rightDetectionActive.load();
+                    if (!detectionActive || depth > kStrokeSurfaceDepth) return;
+
+                    if (ev.caught && !ev.caughtFromAir) {
+                        // Catch under water (breaststroke): no entry splash happened, so mark the stroke start
+                        const float amt = ComputeEntrySplashAmount(std::min(ev.speed, kMaxEntryDownSpeed)) * cfgStrokeSplashScale * 0.5f;
+                        if (amt > 0.0f) QueueRipple(RippleSource::Wake, ev.surfacePoint, amt);
+                    }
+                    if (ev.released) {
+                        const float amt = ComputeExitSplashAmount(std::min(ev.speed, kMaxExitUpSpeed)) * cfgStrokeSplashScale;
+                        if (amt <= 0.0f) return;
+                        RE::NiPointer<RE::NiAVObject> nodeRef(node);
+                        const RE::NiPoint3 surfacePoint = ev.surfacePoint;
+                        const float speed = ev.speed;
+                        const float vol = cfgStrokeSplashVolume;
+                        PostTask(TaskType::StrokeSplash, [nodeRef, surfacePoint, amt, speed, vol]() {
+                            if (g_gameLoadInProgress.load()) return;
+                            EmitRipple(surfacePoint, amt, RippleSource::Exit);
+                            PlayExitSplashAtNode(nodeRef.get(), speed, vol);
+                        });
+                    }
+                };
+                updateStroke(leftStroke, true, leftNode, leftMotion, leftInWater, leftPos, leftWaterHeight, leftControllerDepth, leftDt,
+                    leftStrokeHold, leftStrokeRelease);
+                updateStroke(rightStroke, false, rightNode, rightMotion, rightInWater, rightPos, rightWaterHeight, rightControllerDepth, rightDt,
+                    rightStrokeHold, rightStrokeRelease);
+            } else {
+                leftStroke.Reset();
+                rightStroke.Reset();
+            }
+
       if (cfgWakeEnabled) {
         auto nowMs = std::chrono::duration_cast<std::chrono::milliseconds>(now.time_since_epoch()).count();
- if (g_leftDetectionActive.load() && leftInWater && recentLeftSpeed > wakeSpeedThreshold && leftControllerDepth >= kMinWakeDepthMeters) {
-  long long lastMs = g_leftLastWakeMs.load();
-   if (cfgWakeSpawnMs == 0 || nowMs - lastMs >= cfgWakeSpawnMs) {
-         float mult = std::clamp(recentLeftSpeed * cfgWakeScaleMultiplier, cfgWakeMinMultiplier, cfgWakeMaxMultiplier);
-          RE::NiPoint3 wakePos = leftPos;
-               wakePos.z = leftWaterHeight;
-           float finalAmt = cfgWakeAmt * mult;
-  auto taskIntf = SKSE::GetTaskInterface();
- if (taskIntf) {
-                taskIntf->AddTask([wakePos, finalAmt]() {
-      if (!g_gameLoadInProgress.load()) EmitWakeRipple(true, wakePos, finalAmt);
-                });
-                  }
-       g_leftLastWakeMs.store(nowMs);
-       TryPlayWakeMoveSound(true);
-          }
-       }
-  if (g_rightDetectionActive.load() && rightInWater && recentRightSpeed > wakeSpeedThreshold && rightControllerDepth >= kMinWakeDepthMeters) {
-          long long lastMs = g_rightLastWakeMs.load();
-    if (cfgWakeSpawnMs == 0 || nowMs - lastMs >= cfgWakeSpawnMs) {
-   float mult = std::clamp(recentRightSpeed * cfgWakeScaleMultiplier, cfgWakeMinMultiplier, cfgWakeMaxMultiplier);
-         RE::NiPoint3 wakePos = rightPos;
-     wakePos.z = rightWaterHeight;
-             float finalAmt = cfgWakeAmt * mult;
-        auto taskIntf = SKSE::GetTaskInterface();
-        if (taskIntf) {
-   taskIntf->AddTask([wakePos, finalAmt]() {
-   if (!g_gameLoadInProgress.load()) EmitWakeRipple(false, wakePos, finalAmt);
-            });
-   }
-     g_rightLastWakeMs.store(nowMs);
-         TryPlayWakeMoveSound(false);
-}
-      }
+            const WakeTrailParams wakeParams{ cfgWakeTrailSpacing, cfgWakeTrailMaxRipples, cfgWakeAmt,
+                cfgWakeScaleMultiplier, cfgWakeMinMultiplier, cfgWakeMaxMultiplier };
+            // Each tick adds the filtered hand point to the trail; emissions lay ripples along the path since the last one
+            auto updateWakeTrail = [&](WakeTrail& trail, bool isLeft, bool wakeActive, bool strokeHold, bool strokeRelease,
+                                       const MotionState& motion, const RE::NiPoint3& rawPos, float waterZ, float speed, float depth) {
+                auto& lastWakeMs = isLeft ? g_leftLastWakeMs : g_rightLastWakeMs;
+                // The pull's whole path at once, in step with the stroke splash
+                if (strokeRelease && trail.Emit(wakeParams) > 0) lastWakeMs.store(nowMs);
+                if (!wakeActive) {
+                    trail.Reset();
+                    return;
+                }
+                RE::NiPoint3 surfacePos = motion.valid ? RE::NiPoint3{ motion.pos.x, motion.pos.y, waterZ } : rawPos;
+                surfacePos.z = waterZ;
+                trail.AddSample(surfacePos, speed, depth);
+                // Mid-stroke the path only accumulates
+                if (strokeHold) return;
+                if (cfgWakeSpawnMs != 0 && nowMs - lastWakeMs.load() < cfgWakeSpawnMs) return;
+                if (trail.Emit(wakeParams) > 0) {
+                    lastWakeMs.store(nowMs);
+                    TryPlayWakeMoveSound(isLeft);
+                }
+            };
+            updateWakeTrail(leftWakeTrail, true,
+                g_leftDetectionActive.load() && WakeActive(leftInWater, recentLeftSpeed, leftControllerDepth, detectionParams),
+                leftStrokeHold, leftStrokeRelease, leftMotion, leftPos, leftWaterHeight, recentLeftSpeed, leftControllerDepth);
+            updateWakeTrail(rightWakeTrail, false,
+                g_rightDetectionActive.load() && WakeActive(rightInWater, recentRightSpeed, rightControllerDepth, detectionParams),
+                rightStrokeHold, rightStrokeRelease, rightMotion, rightPos, rightWaterHeight, recentRightSpeed, rightControllerDepth);
+   } else {
+            leftWakeTrail.Reset();
+            rightWakeTrail.Reset();
    }
 
+            // Feet: gated to the wading range (surface between just below the soles and about knee height)
+            {
+                const float surfaceAboveRoot = playerWater.surfaceZ - playerPos.z;
+                const bool wading = cfgWadingEnabled && playerWater.hasWater && !swimming &&
+                    surfaceAboveRoot >= -kFootProbeAboveSurface && surfaceAboveRoot <= cfgWadingMaxDepth;
+                const float footDt = footProbesActive ? std::chrono::duration<float>(now - prevFootTime).count() : 0.0f;
+                prevFootTime = now;
+
+                if (!wading) {
+                    if (footProbesActive) {
+                        leftFootProbe.Reset();
+                        rightFootProbe.Reset();
+                        footProbesActive = false;
+                    }
+                } else {
+                    footProbesActive = true;
+                    auto nowMs = std::chrono::duration_cast<std::chrono::milliseconds>(now.time_since_epoch()).count();
+                    FootProbe* feet[2] = { &leftFootProbe, &rightFootProbe };
+                    for (int f = 0; f < 2; ++f) {
+                        const FootEvent& ev = feet[f]->Update(root, f == 0, playerWater.surfaceZ, footDt, filterParams);
+                        RE::NiAVObject* footNode = feet[f]->Node();
+                        if (!footNode) continue;
+                        if (ev.entry || ev.exit) {
+                            TraceProbeTransition(f == 0 ? Trace::Probe::LeftFoot : Trace::Probe::RightFoot, ev.entry, ev.speed);
+                        }
+
+                        // Deeper water makes a heavier splash for the same step speed
+                        const float depthScale = std::clamp(0.5f + surfaceAboveRoot / kFootFullSplashDepth, 0.5f, 1.5f);
+                        if (ev.entry && ev.speed >= cfgEntryDownZThreshold && nowMs - lastFootSplashMs[f] >= kFootSplashCooldownMs) {
+                            const float amt = ComputeEntrySplashAmount(std::min(ev.speed, kMaxEntryDownSpeed)) * cfgWadingSplashScale * depthScale;
+                            if (amt > 0.0f) {
+                                lastFootSplashMs[f] = nowMs;
+                                RE::NiPointer<RE::NiAVObject> nodeRef(footNode);
+                                const RE::NiPoint3 impactPos = ev.surfacePoint;
+                                const float speed = ev.speed;
+                                const float vol = cfgWadingSplashVolume * std::min(1.0f, depthScale);
+                                auto taskIntf = SKSE::GetTaskInterface();
+                                if (taskIntf) {
+                                    PostTask(TaskType::FootSplash, [nodeRef, impactPos, amt, speed, vol]() {
+                                        if (g_gameLoadInProgress.load()) return;
+                                        EmitRipple(impactPos, amt, RippleSource::Entry);
+                                        PlayEntrySplashAtNode(nodeRef.get(), speed, vol);
+                                    });
+                                }
+                            }
+                        } else if (ev.exit && ev.speed >= cfgExitUpZThreshold && nowMs - lastFootSplashMs[f] >= kFootSplashCooldownMs) {
+                            const float amt = ComputeExitSplashAmount(std::min(ev.speed, kMaxExitUpSpeed)) * cfgWadingSplashScale * depthScale;
+                            if (amt > 0.0f) {
+                                lastFootSplashMs[f] = nowMs;
+                                RE::NiPointer<RE::NiAVObject> nodeRef(footNode);
+                                const RE::NiPoint3 surfacePoint = ev.surfacePoint;
+                                const float speed = ev.speed;
+                                const float vol = cfgWadingSplashVolume * std::min(1.0f, depthScale);
+                                auto taskIntf = SKSE::GetTaskInterface();
+                                if (taskIntf) {
+                                    PostTask(TaskType::FootSplash, [nodeRef, surfacePoint, amt, speed, vol]() {
+                                        if (g_gameLoadInProgress.load()) return;
+                                        EmitRipple(surfacePoint, amt, RippleSource::Exit);
+                                        PlayExitSplashAtNode(nodeRef.get(), speed, vol);
+                                    });
+                                }
+                            }
+                        } else if (cfgWakeEnabled && feet[f]->InWater() && feet[f]->HorizontalSpeed() > kFootWakeSpeed) {
+                            const float mult = std::clamp(feet[f]->HorizontalSpeed() * cfgWakeScaleMultiplier, cfgWakeMinMultiplier, cfgWakeMaxMultiplier);
+                            RE::NiPoint3 wakePos = footNode->world.translate;
+                            wakePos.z = playerWater.surfaceZ;
+                            QueueRipple(RippleSource::Wake, wakePos, cfgWakeAmt * mult * cfgWadingSplashScale);
+                        }
+                    }
+                }
+            }
+
+            const HandTransition leftTransition = DetectTransition(leftInWater, lastLeftInWater, havePrevLeft, leftVelZ, detectionParams);
+            const HandTransition rightTransition = DetectTransition(rightInWater, lastRightInWater, havePrevRight, rightVelZ, detectionParams);
+
           // Left entry
-  if (g_leftDetectionActive.load() && leftInWater && !lastLeftInWater) {
+  if (g_leftDetectionActive.load() && leftTransition.entered) {
       g_lastLeftTransitionMs.store(std::chrono::duration_cast<std::chrono::milliseconds>(now.time_since_epoch()).count());
     g_leftSubmergedStartMs.store(g_lastLeftTransitionMs.load());
      RE::NiPoint3 impactPos = leftPos;
      impactPos.z = leftWaterHeight;
-       float downSpeed = (havePrevLeft && leftDt > 0.0001f) ? std::max(0.0f, (prevLeftPos.z - leftPos.z) / leftDt) : 0.0f;
+       float downSpeed = leftTransition.speed;
+   TraceProbeTransition(Trace::Probe::LeftHand, true, downSpeed);
    prevLeftWaterHeight = leftWaterHeight;
-            if (havePrevLeft && downSpeed >= cfgEntryDownZThreshold && downSpeed <= kMaxEntryDownSpeed) {
+            if (leftTransition.splash) {
          float amt = ComputeEntrySplashAmount(downSpeed);
          if (amt > 0.0f) {
               auto taskIntf = SKSE::GetTaskInterface();
       if (taskIntf) {
-   taskIntf->AddTask([impactPos, amt, downSpeed]() {
+   PostTask(TaskType::EntrySplash, [impactPos, amt, downSpeed]() {
         if (g_gameLoadInProgress.load()) return;
       EmitSplashIfAllowed(true, impactPos, amt, true, 1, "left_entry");
     PlaySplashSoundForDownSpeed(true, downSpeed, false);
@@ -550,19 +773,21 @@ prevLeftMovingLocal = leftMoving;
    }
 
      // Left exit
-            if (g_leftDetectionActive.load() && !leftInWater && lastLeftInWater) {
+            if (g_leftDetectionActive.load() && leftTransition.exited) {
        g_lastLeftTransitionMs.store(std::chrono::duration_cast<std::chrono::milliseconds>(now.time_since_epoch()).count());
     RE::NiPoint3 impactPos = leftPos;
   impactPos.z = prevLeftWaterHeight;
-     float upSpeed = (havePrevLeft && leftDt > 0.0001f) ? std::max(0.0f, (leftPos.z - prevLeftPos.z) / leftDt) : 0.0f;
-     if (havePrevLeft && upSpeed >= cfgExitUpZThreshold && upSpeed <= kMaxExitUpSpeed) {
+     float upSpeed = leftTransition.speed;
+     TraceProbeTransition(Trace::Probe::LeftHand, false, upSpeed);
+     // A stroke released by this exit already splashed and played its sound
+     if (leftTransition.splash && !leftStrokeRelease) {
                float exitAmt = ComputeExitSplashAmount(upSpeed);
         if (exitAmt <= 0.0f) exitAmt = cfgSplashNormalAmt * cfgSplashScale;
    auto taskIntf = SKSE::GetTaskInterface();
     if (taskIntf) {
-       taskIntf->AddTask([impactPos, exitAmt, upSpeed]() {
+       PostTask(TaskType::ExitSplash, [impactPos, exitAmt, upSpeed]() {
       if (g_gameLoadInProgress.load()) return;
-   if (EmitSplashIfAllowed(true, impactPos, exitAmt, true, 0, "left_exit")) {
+   if (EmitSplashIfAllowed(true, impactPos, exitAmt, true, 0, "left_exit", RippleSource::Exit)) {
                 PlayExitSoundForUpSpeed(true, upSpeed);
        }
      });
@@ -572,19 +797,20 @@ prevLeftMovingLocal = leftMoving;
        }
 
     // Right entry
-            if (g_rightDetectionActive.load() && rightInWater && !lastRightInWater) {
+            if (g_rightDetectionActive.load() && rightTransition.entered) {
           g_lastRightTransitionMs.store(std::chrono::duration_cast<std::chrono::milliseconds>(now.time_since_epoch()).count());
   g_rightSubmergedStartMs.store(g_lastRightTransitionMs.load());
          RE::NiPoint3 impactPos = rightPos;
         impactPos.z = rightWaterHeight;
-           float downSpeed = (havePrevRight && rightDt > 0.0001f) ? std::max(0.0f, (prevRightPos.z - rightPos.z) / rightDt) : 0.0f;
+           float downSpeed = rightTransition.speed;
+           TraceProbeTransition(Trace::Probe::RightHand, true, downSpeed);
             prevRightWaterHeight = rightWaterHeight;
-    if (havePrevRight && downSpeed >= cfgEntryDownZThreshold && downSpeed <= kMaxEntryDownSpeed) {
+    if (rightTransition.splash) {
            float amt = ComputeEntrySplashAmount(downSpeed);
    if (amt > 0.0f) {
        auto taskIntf = SKSE::GetTaskInterface();
    if (taskIntf) {
-    taskIntf->AddTask([impactPos, amt, downSpeed]() {
+    PostTask(TaskType::EntrySplash, [impactPos, amt, downSpeed]() {
          if (g_gameLoadInProgress.load()) return;
        EmitSplashIfAllowed(false, impactPos, amt, true, 1, "right_entry");
   PlaySplashSoundForDownSpeed(false, downSpeed, false);
@@ -595,19 +821,20 @@ prevLeftMovingLocal = leftMoving;
             }
 
    // Right exit
-            if (g_rightDetectionActive.load() && !rightInWater && lastRightInWater) {
+            if (g_rightDetectionActive.load() && rightTransition.exited) {
            g_lastRightTransitionMs.store(std::chrono::duration_cast<std::chrono::milliseconds>(now.time_since_epoch()).count());
         RE::NiPoint3 impactPos = rightPos;
      impactPos.z = prevRightWaterHeight;
-    float upSpeed = (havePrevRight && rightDt > 0.0001f) ? std::max(0.0f, (rightPos.z - prevRightPos.z) / rightDt) : 0.0f;
-   if (havePrevRight && upSpeed >= cfgExitUpZThreshold && upSpeed <= kMaxExitUpSpeed) {
+    float upSpeed = rightTransition.speed;
+    TraceProbeTransition(Trace::Probe::RightHand, false, upSpeed);
+   if (rightTransition.splash && !rightStrokeRelease) {
          float exitAmt = ComputeExitSplashAmount(upSpeed);
        if (exitAmt <= 0.0f) exitAmt = cfgSplashNormalAmt * cfgSplashScale;
     auto taskIntf = SKSE::GetTaskInterface();
                 if (taskIntf) {
-           taskIntf->AddTask([impactPos, exitAmt, upSpeed]() {
+           PostTask(TaskType::ExitSplash, [impactPos, exitAmt, upSpeed]() {
      if (g_gameLoadInProgress.load()) return;
-         if (EmitSplashIfAllowed(false, impactPos, exitAmt, true, 0, "right_exit")) {
+         if (EmitSplashIfAllowed(false, impactPos, exitAmt, true, 0, "right_exit", RippleSource::Exit)) {
           PlayExitSoundForUpSpeed(false, upSpeed);
    }
             });
@@ -632,11 +859,13 @@ prevLeftMovingLocal = leftMoving;
 
    if (leftSubmergedWithSpell != g_prevLeftSubmergedWithSpell.load()) {
    g_prevLeftSubmergedWithSpell.store(leftSubmergedWithSpell);
+   TraceSpellEdge(true, leftSpell ? leftSpell->GetFormID() : 0, leftSubmergedWithSpell);
               if (leftSubmergedWithSpell) IW_LOG_INFO("Left controller submerged with spell");
        else IW_LOG_INFO("Left controller no longer submerged with spell");
           }
             if (rightSubmergedWithSpell != g_prevRightSubmergedWithSpell.load()) {
       g_prevRightSubmergedWithSpell.store(rightSubmergedWithSpell);
+      TraceSpellEdge(false, rightSpell ? rightSpell->GetFormID() : 0, rightSubmergedWithSpell);
      if (rightSubmergedWithSpell) IW_LOG_INFO("Right controller submerged with spell");
          else IW_LOG_INFO("Right controller no longer submerged with spell");
   }
@@ -660,8 +889,6 @@ s_submergedMagicDamageShock.store(shockNow);
      g_leftSubmerged.store(leftInWater);
          g_rightSubmerged.store(rightInWater);
 
-            prevLeftPos = leftPos;
-prevRightPos = rightPos;
         prevLeftTime = now;
             prevRightTime = now;
        havePrevLeft = true;
@@ -669,31 +896,54 @@ prevRightPos = rightPos;
           lastLeftInWater = leftInWater;
    lastRightInWater = rightInWater;
 
+            // Wakes are only queued above; hand them to the main thread in one task
+            PumpRippleQueue();
+            PumpDeferredTasks();
+
+            TelemetrySet(TelemetryBlock().probesInWater, static_cast<std::uint32_t>(
+                (leftInWater ? 1 : 0) + (rightInWater ? 1 : 0) +
+                (leftFootProbe.InWater() ? 1 : 0) + (rightFootProbe.InWater() ? 1 : 0)));
+            TelemetryRecordStage(Telemetry::Stage::Tick, static_cast<std::uint32_t>(
+                std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - tickStart).count()));
+
         } catch (...) {
- std::this_thread::sleep_for(std::chrono::milliseconds(250));
+            return std::chrono::milliseconds(250);
         }
 
-        std::this_thread::sleep_for(std::chrono::milliseconds(kPollIntervalMs));
-    }
+    return TickPeriod();
 }
 
+// Only touched by Start/StopWaterMonitoring (main thread)
+static JobHandle s_monitorJob;
+
 void StartWaterMonitoring() {
     if (g_running.exchange(true)) return;
  g_leftDetectionActive.store(true);
   g_rightDetectionActive.store(true);
-    g_suspendAllDetections.store(false);
+    if (g_suspendAllDetections.exchange(false)) TraceSuspension(false, Trace::SuspendReason::Reset);
     g_prevLeftMoving.store(false);
     g_prevRightMoving.store(false);
     g_leftRippleEmitted.store(false);
   g_rightRippleEmitted.store(false);
     g_prevPlayerSwimming.store(false);
-    IW_LOG_INFO("StartWaterMonitoring: starting monitoring thread with detection enabled");
-    g_monitorThread = std::thread(MonitoringThread);
+    IW_LOG_INFO("StartWaterMonitoring: starting monitor job with detection enabled");
+    // The context is built on the first run so config loading stays off the caller's thread
+    s_monitorJob = SchedulePeriodicJob(JobType::WaterMonitor, JobDelay::zero(),
+        [ctx = std::unique_ptr<MonitorContext>()]() mutable -> JobDelay {
+            if (!ctx) ctx = std::make_unique<MonitorContext>();
+            return ctx->Tick();
+        });
+    if (!s_monitorJob.Valid()) {
+        IW_LOG_WARN("StartWaterMonitoring: no job slot for the monitor");
+        g_running.store(false);
+    }
 }
 
 void StopWaterMonitoring() {
     if (!g_running.exchange(false)) return;
-    if (g_monitorThread.joinable()) g_monitorThread.join();
+    // A tick never sleeps, so this waits for at most the tick in progress
+    const long long waitedUs = CancelJob(s_monitorJob);
+    IW_LOG_INFO("StopWaterMonitoring: water monitor stopped in %.2f ms", static_cast<double>(waitedUs) / 1000.0);
     g_prevLeftMoving.store(false);
     g_prevRightMoving.store(false);
     g_prevPlayerSwimming.store(false);
@@ -22,6 +22,13 @@ namespace InteractiveWaterVR
  // Query whether a game load is currently in progress
  bool IsGameLoadInProgress();
 
+ // Drop the monitor's sample history (filters, velocities, probes) before its next tick; used after
+ // a suspension and whenever the player is moved by the engine (fast travel, cell change)
+ void ResetWaterMonitorHistory();
+
+ // Record the moment a save/new game finished loading; the monitoring thread logs the latency to its first detection tick
+ void MarkGameLoadFinished();
+
  // Clear all cached form pointers and reset state - MUST be called on every game load
  void ClearCachedForms();
 
@@ -0,0 +1,64 @@
+// water_foot_probe.cpp - Player foot probes for wading and footstep splashes
+
+#include "water_foot_probe.h"
+#include <algorithm>
+#include <cmath>
+
+namespace InteractiveWaterVR {
+
+// ============================================================================
+// Constants
+// ============================================================================
+
+static const char* const kFootNodes[2] = { "NPC L Foot [Lft ]", "NPC R Foot [Rft ]" };
+static const char* const kCalfNodes[2] = { "NPC L Calf [LClf]", "NPC R Calf [RClf]" };
+
+// ============================================================================
+// FootProbe
+// ============================================================================
+
+void FootProbe::Reset() {
+    _resolvedRoot = nullptr;
+    _node.reset();
+    _filter.Reset();
+    _event = FootEvent{};
+    _inWater = false;
+    _hasState = false;
+    _depth = 0.0f;
+    _horizSpeed = 0.0f;
+}
+
+const FootEvent& FootProbe::Update(RE::NiAVObject* root, bool isLeft, float surfaceZ, float dt, const MotionFilterParams& params) {
+    _event = FootEvent{};
+
+    if (root != _resolvedRoot) {
+        const int side = isLeft ? 0 : 1;
+        RE::NiAVObject* node = root ? root->GetObjectByName(kFootNodes[side]) : nullptr;
+        if (!node && root) node = root->GetObjectByName(kCalfNodes[side]);
+        _node.reset(node);
+        _resolvedRoot = root;
+        _filter.Reset();
+        _hasState = false;
+    }
+    if (!_node) return _event;
+
+    const RE::NiPoint3 pos = _node->world.translate;
+    const MotionState& st = _filter.Update(pos.x, pos.y, pos.z, dt, params);
+    _horizSpeed = st.valid ? std::sqrt(st.vel.x * st.vel.x + st.vel.y * st.vel.y) : 0.0f;
+
+    const bool inWater = pos.z < surfaceZ;
+    _depth = inWater ? surfaceZ - pos.z : 0.0f;
+
+    if (_hasState && st.valid && inWater != _inWater) {
+        _event.entry = inWater;
+        _event.exit = !inWater;
+        _event.speed = inWater ? std::max(0.0f, -st.vel.z) : std::max(0.0f, st.vel.z);
+        _event.surfacePoint = RE::NiPoint3{ pos.x, pos.y, surfaceZ };
+    }
+
+    _inWater = inWater;
+    _hasState = true;
+    return _event;
+}
+
+} // namespace InteractiveWaterVR
@@ -0,0 +1,49 @@
+#pragma once
+// water_foot_probe.h - Player foot probes for wading and footstep splashes
+
+#include "motion_filter.h"
+#include <RE/Skyrim.h>
+
+namespace InteractiveWaterVR {
+
+// ============================================================================
+// Foot transition result
+// ============================================================================
+
+struct FootEvent {
+    bool entry = false;             // foot went below the surface this tick
+    bool exit = false;              // foot came back out this tick
+    float speed = 0.0f;             // vertical speed for entry/exit (units/s, positive)
+    RE::NiPoint3 surfacePoint{};    // surface point above the foot
+};
+
+// ============================================================================
+// Single foot probe
+// ============================================================================
+
+// Tracks one foot bone (calf as a fallback for skeletons without feet). It is tested against the
+// water plane the caller already queried at the player's position, so wading adds no extra water
+// lookups per tick.
+class FootProbe {
+public:
+    void Reset();
+
+    const FootEvent& Update(RE::NiAVObject* root, bool isLeft, float surfaceZ, float dt, const MotionFilterParams& params);
+
+    RE::NiAVObject* Node() const { return _node.get(); }
+    bool InWater() const { return _inWater; }
+    float Depth() const { return _depth; }
+    float HorizontalSpeed() const { return _horizSpeed; }
+
+private:
+    RE::NiAVObject* _resolvedRoot = nullptr;
+    RE::NiPointer<RE::NiAVObject> _node;
+    MotionFilter _filter;
+    FootEvent _event;
+    bool _inWater = false;
+    bool _hasState = false;
+    float _depth = 0.0f;
+    float _horizSpeed = 0.0f;
+};
+
+} // namespace InteractiveWaterVR
@@ -0,0 +1,116 @@
+// water_hand_probe.cpp - Fingertip-resolution hand submersion
+
+#include "water_hand_probe.h"
+#include "higgsinterface.h"
+#include <algorithm>
+
+namespace InteractiveWaterVR {
+
+// ============================================================================
+// Constants
+// ============================================================================
+
+// Fingertip bones, thumb to pinky (matches the HIGGS GetFingerValues order)
+static const char* const kLeftFingertipNodes[HandProbeSet::kProbeCount - 1] = {
+    "NPC L Finger02 [LF02]",
+    "NPC L Finger12 [LF12]",
+    "NPC L Finger22 [LF22]",
+    "NPC L Finger32 [LF32]",
+    "NPC L Finger42 [LF42]"
+};
+
+static const char* const kRightFingertipNodes[HandProbeSet::kProbeCount - 1] = {
+    "NPC R Finger02 [RF02]",
+    "NPC R Finger12 [RF12]",
+    "NPC R Finger22 [RF22]",
+    "NPC R Finger32 [RF32]",
+    "NPC R Finger42 [RF42]"
+};
+
+// Depth over which a single probe goes from touching to fully submerged (roughly a finger's thickness)
+constexpr float kProbeSubmergeDepth = 1.5f;
+// Weight of a fully curled finger relative to a fully extended one
+constexpr float kCurledFingerWeight = 0.25f;
+// Weight of the wrist/hand probe
+constexpr float kHandProbeWeight = 1.0f;
+
+// ============================================================================
+// HandProbeSet
+// ============================================================================
+
+void HandProbeSet::Reset() {
+    _resolvedRoot = nullptr;
+    for (auto& n : _fingerNodes) {
+        n.reset();
+    }
+    _state = HandSubmersion{};
+}
+
+void HandProbeSet::ResolveNodes(RE::NiAVObject* root, bool isLeft) {
+    const auto& names = isLeft ? kLeftFingertipNodes : kRightFingertipNodes;
+    for (std::size_t i = 0; i < kProbeCount - 1; ++i) {
+        _fingerNodes[i].reset(root ? root->GetObjectByName(names[i]) : nullptr);
+    }
+    _resolvedRoot = root;
+}
+
+const HandSubmersion& HandProbeSet::Update(RE::NiAVObject* root, RE::NiAVObject* handNode, bool isLeft, bool hasWater, float surfaceZ) {
+    const bool wasInContact = _state.submergedFraction > 0.0f;
+    _state.newContact = false;
+
+    if (!handNode || !hasWater) {
+        _state.submergedFraction = 0.0f;
+        return _state;
+    }
+
+    // Bone lookups are a tree search: only repeat them when the skeleton root changes
+    if (root != _resolvedRoot) {
+        ResolveNodes(root, isLeft);
+    }
+
+    // Fingertip weights from HIGGS curl values (1 = open, 0 = curled); all open without HIGGS
+    float open[kProbeCount - 1] = { 1.0f, 1.0f, 1.0f, 1.0f, 1.0f };
+    if (HiggsPluginAPI::g_higgsInterface) {
+        HiggsPluginAPI::g_higgsInterface->GetFingerValues(isLeft, open);
+    }
+
+    // Gather probe heights and weights into flat arrays, then test them against the plane in one pass
+    float z[kProbeCount];
+    float w[kProbeCount];
+    const RE::NiAVObject* nodes[kProbeCount];
+    nodes[0] = handNode;
+    z[0] = handNode->world.translate.z;
+    w[0] = kHandProbeWeight;
+    for (std::size_t i = 1; i < kProbeCount; ++i) {
+        const auto* n = _fingerNodes[i - 1].get();
+        nodes[i] = n ? n : handNode;
+        z[i] = nodes[i]->world.translate.z;
+        w[i] = n ? (kCurledFingerWeight + (1.0f - kCurledFingerWeight) * std::clamp(open[i - 1], 0.0f, 1.0f)) : 0.0f;
+    }
+
+    float sub[kProbeCount];
+    float weighted = 0.0f;
+    float totalWeight = 0.0f;
+    for (std::size_t i = 0; i < kProbeCount; ++i) {
+        sub[i] = std::clamp((surfaceZ - z[i]) / kProbeSubmergeDepth, 0.0f, 1.0f);
+        weighted += sub[i] * w[i];
+        totalWeight += w[i];
+    }
+    _state.submergedFraction = totalWeight > 0.0f ? weighted / totalWeight : 0.0f;
+
+    // First contact: report the surface point above the deepest probe
+    if (!wasInContact && _state.submergedFraction > 0.0f) {
+        std::size_t deepest = 0;
+        for (std::size_t i = 1; i < kProbeCount; ++i) {
+            if (z[i] < z[deepest] && w[i] > 0.0f) {
+                deepest = i;
+            }
+        }
+        _state.newContact = true;
+        _state.contactPoint = nodes[deepest]->world.translate;
+        _state.contactPoint.z = surfaceZ;
+    }
+    return _state;
+}
+
+} // namespace InteractiveWaterVR
@@ -0,0 +1,45 @@
+#pragma once
+// water_hand_probe.h - Fingertip-resolution hand submersion
+
+#include <RE/Skyrim.h>
+#include <cstddef>
+
+namespace InteractiveWaterVR {
+
+// ============================================================================
+// Hand submersion result
+// ============================================================================
+
+struct HandSubmersion {
+    float submergedFraction = 0.0f;  // 0 = dry, 1 = every probe fully under (weighted by finger extension)
+    bool newContact = false;         // true on the tick the first probe touched the water
+    RE::NiPoint3 contactPoint{};     // surface point above the deepest probe at first contact
+};
+
+// ============================================================================
+// Multi-probe hand model
+// ============================================================================
+
+// Samples the hand node plus the five fingertip bones. Fingertip weights follow HIGGS finger curl
+// (an extended finger reaches the water first, a curled one is tucked against the palm). All probes
+// are tested against the single water plane already queried for the hand in one pass.
+class HandProbeSet {
+public:
+    static constexpr std::size_t kProbeCount = 6;  // hand node + thumb, index, middle, ring, pinky tips
+
+    void Reset();
+
+    // handNode is the hand bone used for the wrist probe; fingertips are looked up below root and cached
+    const HandSubmersion& Update(RE::NiAVObject* root, RE::NiAVObject* handNode, bool isLeft, bool hasWater, float surfaceZ);
+
+    const HandSubmersion& State() const { return _state; }
+
+private:
+    void ResolveNodes(RE::NiAVObject* root, bool isLeft);
+
+    RE::NiAVObject* _resolvedRoot = nullptr;
+    RE::NiPointer<RE::NiAVObject> _fingerNodes[kProbeCount - 1];
+    HandSubmersion _state;
+};
+
+} // namespace InteractiveWaterVR
@@ -0,0 +1,173 @@
+// water_higgs_velocity.cpp - Hand and weapon velocities read from HIGGS rigid bodies
+
+#include "water_higgs_velocity.h"
+#include "water_state.h"
+#include "water_utils.h"
+#include "water_ripple.h"
+#include "higgsinterface.h"
+#include "helper.h"
+#include "config.h"
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstring>
+#include <mutex>
+
+namespace InteractiveWaterVR {
+
+// ============================================================================
+// Constants
+// ============================================================================
+
+namespace {
+
+// Havok world units to Skyrim units
+constexpr float kHavokToSkyrimScale = 69.99125f;
+// A sample older than this (a few frames) is not used; the filtered estimate takes over
+constexpr long long kHiggsVelocityMaxAgeMs = 50;
+// Tip must move at least this fast horizontally (units/s) to leave a wake
+constexpr float kWeaponTipWakeSpeed = 60.0f;
+// Ignore the tip once it is deeper than this below the surface (fully submerged blade makes no wake)
+constexpr float kWeaponTipMaxWakeDepth = 30.0f;
+
+// ============================================================================
+// Published samples
+// ============================================================================
+
+struct HandVelocitySample {
+    bool valid = false;
+    RE::NiPoint3 linear{};
+    long long sampleMs = 0;
+};
+
+std::mutex s_sampleMutex;
+HandVelocitySample s_hands[2];  // [0] = left, [1] = right
+
+long long VelocityNowMs() {
+    return std::chrono::duration_cast<std::chrono::milliseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+RE::NiPoint3 ToNiPoint(const RE::hkVector4& v) {
+    float f[4];
+    std::memcpy(f, &v, sizeof(f));
+    return RE::NiPoint3{ f[0] * kHavokToSkyrimScale, f[1] * kHavokToSkyrimScale, f[2] * kHavokToSkyrimScale };
+}
+
+RE::hkpRigidBody* GetHavokBody(RE::NiObject* obj) {
+    auto bhk = obj ? obj->AsBhkRigidBody() : nullptr;
+    return bhk ? static_cast<RE::hkpRigidBody*>(bhk->referencedObject.get()) : nullptr;
+}
+
+// Linear velocity (of the centre of mass) in game units/s; angular velocity stays in rad/s. The
+// centre of mass is the world position at the end of the last physics step, in game units.
+bool ReadBodyVelocity(RE::NiObject* obj, RE::NiPoint3& linear, RE::NiPoint3* angular, RE::NiPoint3* centreOfMass = nullptr) {
+    auto body = GetHavokBody(obj);
+    if (!body) return false;
+    linear = ToNiPoint(body->motion.linearVelocity);
+    if (angular) {
+        float f[4];
+        std::memcpy(f, &body->motion.angularVelocity, sizeof(f));
+        *angular = RE::NiPoint3{ f[0], f[1], f[2] };
+    }
+    if (centreOfMass) *centreOfMass = ToNiPoint(body->motion.motionState.sweptTransform.centerOfMass1);
+    return true;
+}
+
+// ============================================================================
+// Weapon tip
+// ============================================================================
+
+// Tip = far end of the weapon's bounding sphere along the grip-to-centre direction. Havok's linear
+// velocity is that of the body's centre of mass, so the tip adds the rotation about the centre of
+// mass: v_tip = v_com + w x (tip - com).
+void ProcessWeaponTip(bool isLeft, RE::NiAVObject* root) {
+    auto higgs = HiggsPluginAPI::g_higgsInterface;
+    RE::NiAVObject* weaponNode = root ? root->GetObjectByName(isLeft ? "SHIELD" : "WEAPON") : nullptr;
+    if (!higgs || !weaponNode) return;
+
+    RE::NiPoint3 linear;
+    RE::NiPoint3 angular;
+    RE::NiPoint3 com;
+    if (!ReadBodyVelocity(higgs->GetWeaponRigidBody(isLeft), linear, &angular, &com)) return;
+
+    const RE::NiPoint3 grip = weaponNode->world.translate;
+    const RE::NiPoint3 centre = weaponNode->worldBound.center;
+    const float radius = weaponNode->worldBound.radius;
+    RE::NiPoint3 axis = centre - grip;
+    const float axisLen = axis.Length();
+    if (axisLen < 1.0f || radius <= 0.0f) return;
+    axis = axis / axisLen;
+    const RE::NiPoint3 tip = centre + axis * radius;
+
+    const RE::NiPoint3 lever = tip - com;
+    const RE::NiPoint3 tipVel = linear + angular.Cross(lever);
+    const float horizSpeed = std::sqrt(tipVel.x * tipVel.x + tipVel.y * tipVel.y);
+    if (horizSpeed < kWeaponTipWakeSpeed) return;
+
+    WaterQuery q;
+    if (!QueryWater(tip, q) || q.surfaceZ - tip.z > kWeaponTipMaxWakeDepth) return;
+
+    const float mult = std::clamp(horizSpeed * cfgWakeScaleMultiplier, cfgWakeMinMultiplier, cfgWakeMaxMultiplier);
+    QueueRipple(RippleSource::Wake, RE::NiPoint3{ tip.x, tip.y, q.surfaceZ }, cfgWakeAmt * mult);
+}
+
+// ============================================================================
+// Per-frame sampling
+// ============================================================================
+
+void OnFrame() {
+    auto higgs = HiggsPluginAPI::g_higgsInterface;
+    if (!higgs || g_gameLoadInProgress.load()) return;
+
+    const long long nowMs = VelocityNowMs();
+    if (cfgUseHiggsVelocity) {
+        HandVelocitySample samples[2];
+        for (int i = 0; i < 2; ++i) {
+            samples[i].valid = ReadBodyVelocity(higgs->GetHandRigidBody(i == 0), samples[i].linear, nullptr);
+            samples[i].sampleMs = nowMs;
+        }
+        std::lock_guard<std::mutex> lock(s_sampleMutex);
+        s_hands[0] = samples[0];
+        s_hands[1] = samples[1];
+    }
+
+    if (cfgWeaponTipWake && cfgWakeEnabled && !g_suspendAllDetections.load()) {
+        auto player = RE::PlayerCharacter::GetSingleton();
+        RE::NiAVObject* root = player ? player->Get3D() : nullptr;
+        if (root) {
+            ProcessWeaponTip(true, root);
+            ProcessWeaponTip(false, root);
+        }
+    }
+}
+
+}  // namespace
+
+// ============================================================================
+// Public API
+// ============================================================================
+
+void RegisterHiggsVelocityCallbacks() {
+    auto higgs = HiggsPluginAPI::g_higgsInterface;
+    if (!higgs) return;
+    higgs->AddPostVrikPostHiggsCallback(OnFrame);
+    IW_LOG_INFO("RegisterHiggsVelocityCallbacks: sampling hand/weapon rigid-body velocities once per frame");
+}
+
+bool GetHiggsHandVelocity(bool isLeft, RE::NiPoint3& outVelocity) {
+    if (!cfgUseHiggsVelocity) return false;
+    std::lock_guard<std::mutex> lock(s_sampleMutex);
+    const HandVelocitySample& s = s_hands[isLeft ? 0 : 1];
+    if (!s.valid || VelocityNowMs() - s.sampleMs > kHiggsVelocityMaxAgeMs) return false;
+    outVelocity = s.linear;
+    return true;
+}
+
+void ResetHiggsVelocity() {
+    std::lock_guard<std::mutex> lock(s_sampleMutex);
+    s_hands[0] = HandVelocitySample{};
+    s_hands[1] = HandVelocitySample{};
+}
+
+} // namespace InteractiveWaterVR
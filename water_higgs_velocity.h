@@ -0,0 +1,25 @@
+#pragma once
+// water_higgs_velocity.h - Hand and weapon velocities read from HIGGS rigid bodies
+
+#include <RE/Skyrim.h>
+
+namespace InteractiveWaterVR {
+
+// ============================================================================
+// HIGGS rigid-body velocity source
+// ============================================================================
+
+// Once per frame (HIGGS post-update callback) the hand bodies' linear velocities are read and
+// published for the monitoring thread. The same pass derives each weapon's tip velocity from the
+// weapon body's linear and angular velocity and queues a wake while the tip is in the water.
+
+// Register the per-frame sampling callback (call once after the HIGGS interface is obtained)
+void RegisterHiggsVelocityCallbacks();
+
+// Latest hand body velocity in game units/s; false if disabled, unavailable or stale
+bool GetHiggsHandVelocity(bool isLeft, RE::NiPoint3& outVelocity);
+
+// Forget published samples (game load / state reset)
+void ResetHiggsVelocity();
+
+} // namespace InteractiveWaterVR
@@ -0,0 +1,259 @@
+// water_projectiles.cpp - Arrow, bolt and spell projectile water impacts
+
+#include "water_projectiles.h"
+#include "water_state.h"
+#include "water_utils.h"
+#include "water_ripple.h"
+#include "water_sound.h"
+#include "helper.h"
+#include "config.h"
+#include "telemetry.h"
+#include "main_thread_tasks.h"
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cmath>
+
+namespace InteractiveWaterVR {
+
+// ============================================================================
+// Constants
+// ============================================================================
+
+namespace {
+
+constexpr std::size_t kMaxTrackedProjectiles = 64;
+// The cached water plane is refreshed this often, or sooner when the player moves this far
+constexpr long long kWaterPlaneRefreshMs = 250;
+constexpr float kWaterPlaneRefreshDistance = 256.0f;
+
+// ============================================================================
+// Tracking table (main thread only)
+// ============================================================================
+
+struct ProjectileTable {
+    std::size_t count = 0;
+    std::array<RE::ProjectileHandle, kMaxTrackedProjectiles> handle{};
+    std::array<RE::NiPoint3, kMaxTrackedProjectiles> lastPos{};
+    std::array<long long, kMaxTrackedProjectiles> lastPosMs{};   // when lastPos was sampled
+    std::array<std::uint32_t, kMaxTrackedProjectiles> lastSeenFrame{};
+    std::array<bool, kMaxTrackedProjectiles> impacted{};
+};
+
+ProjectileTable s_table;
+std::uint32_t s_frame = 0;
+// Position in the manager's limited+unlimited lists where the next scan starts, so that with more
+// projectiles in range than the cap every one of them is visited in turn
+std::size_t s_cursor = 0;
+
+// Water plane under the player, reused by every projectile in the broad phase
+bool s_planeValid = false;
+float s_planeZ = 0.0f;
+RE::NiPoint3 s_planeOrigin{};
+long long s_planeMs = 0;
+
+std::atomic<bool> s_scanPending{ false };
+std::atomic<std::uint64_t> s_statScanned{ 0 };
+std::atomic<std::uint64_t> s_statCrossings{ 0 };
+std::atomic<std::uint64_t> s_statCapped{ 0 };
+
+long long ProjectileNowMs() {
+    return std::chrono::duration_cast<std::chrono::milliseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+void RefreshWaterPlane(const RE::NiPoint3& playerPos, long long nowMs) {
+    const RE::NiPoint3 d = playerPos - s_planeOrigin;
+    if (s_planeMs != 0 && nowMs - s_planeMs < kWaterPlaneRefreshMs &&
+        d.x * d.x + d.y * d.y < kWaterPlaneRefreshDistance * kWaterPlaneRefreshDistance) {
+        return;
+    }
+    WaterQuery q;
+    QueryWater(playerPos, q);
+    s_planeValid = q.hasWater;
+    s_planeZ = q.surfaceZ;
+    s_planeOrigin = playerPos;
+    s_planeMs = nowMs;
+}
+
+std::size_t Find(const RE::ProjectileHandle& h) {
+    for (std::size_t i = 0; i < s_table.count; ++i) {
+        if (s_table.handle[i] == h) return i;
+    }
+    return kMaxTrackedProjectiles;
+}
+
+std::size_t FindOrAdd(const RE::ProjectileHandle& h, bool& added) {
+    added = false;
+    if (const std::size_t i = Find(h); i != kMaxTrackedProjectiles) return i;
+    if (s_table.count >= kMaxTrackedProjectiles) return kMaxTrackedProjectiles;
+    const std::size_t i = s_table.count++;
+    s_table.handle[i] = h;
+    s_table.impacted[i] = false;
+    added = true;
+    return i;
+}
+
+// Drop entries whose projectile was not seen this frame (hit something, expired, out of range)
+void PurgeStale() {
+    std::size_t i = 0;
+    while (i < s_table.count) {
+        if (s_table.lastSeenFrame[i] == s_frame) {
+            ++i;
+            continue;
+        }
+        const std::size_t last = --s_table.count;
+        s_table.handle[i] = s_table.handle[last];
+        s_table.lastPos[i] = s_table.lastPos[last];
+        s_table.lastPosMs[i] = s_table.lastPosMs[last];
+        s_table.lastSeenFrame[i] = s_table.lastSeenFrame[last];
+        s_table.impacted[i] = s_table.impacted[last];
+        s_table.handle[last] = RE::ProjectileHandle{};
+    }
+}
+
+void ClearTable() {
+    for (std::size_t i = 0; i < s_table.count; ++i) {
+        s_table.handle[i] = RE::ProjectileHandle{};
+    }
+    s_table.count = 0;
+}
+
+void EmitProjectileImpact(RE::Projectile* proj, const RE::NiPoint3& crossing, float downSpeed) {
+    const float amt = ComputeEntrySplashAmount(std::min(downSpeed, kMaxEntryDownSpeed)) * cfgProjectileSplashScale;
+    if (amt <= 0.0f) return;
+    EmitRipple(crossing, amt, RippleSource::Entry);
+    if (auto node = proj->Get3D()) {
+        PlayEntrySplashAtNode(node, downSpeed, cfgProjectileSplashVolume);
+    }
+    s_statCrossings.fetch_add(1);
+}
+
+// Returns true when the projectile is in range but the per-frame cap is already spent. A tracked
+// projectile skipped that way is kept (not visited, not stale): its next visit tests the whole
+// segment since the position it last sampled.
+bool VisitProjectile(const RE::ProjectileHandle& h, const RE::NiPoint3& playerPos, float rangeSq, long long nowMs, int& remaining) {
+    auto projPtr = h.get();
+    RE::Projectile* proj = projPtr.get();
+    if (!proj) return false;
+
+    const RE::NiPoint3 pos = proj->GetPosition();
+    const float px = pos.x - playerPos.x;
+    const float py = pos.y - playerPos.y;
+    if (px * px + py * py > rangeSq) return false;
+
+    if (remaining <= 0) {
+        s_statCapped.fetch_add(1);
+        if (const std::size_t i = Find(h); i != kMaxTrackedProjectiles) s_table.lastSeenFrame[i] = s_frame;
+        return true;
+    }
+    --remaining;
+    s_statScanned.fetch_add(1);
+
+    bool added = false;
+    const std::size_t i = FindOrAdd(h, added);
+    if (i == kMaxTrackedProjectiles) return false;
+    s_table.lastSeenFrame[i] = s_frame;
+
+    const RE::NiPoint3 prev = s_table.lastPos[i];
+    const float dt = static_cast<float>(nowMs - s_table.lastPosMs[i]) / 1000.0f;
+    s_table.lastPos[i] = pos;
+    s_table.lastPosMs[i] = nowMs;
+    if (added || s_table.impacted[i] || dt <= 1e-4f) return false;
+
+    // Broad phase: the segment must go from above the cached plane to at or below it
+    if (!(prev.z > s_planeZ && pos.z <= s_planeZ)) return false;
+
+    const float t = (prev.z - s_planeZ) / (prev.z - pos.z);
+    RE::NiPoint3 crossing{ prev.x + (pos.x - prev.x) * t, prev.y + (pos.y - prev.y) * t, s_planeZ };
+
+    // Narrow phase: confirm there is water at the crossing and use its real height
+    WaterQuery q;
+    QueryWater(RE::NiPoint3{ crossing.x, crossing.y, crossing.z - 1.0f }, q);
+    if (!q.hasWater || std::abs(q.surfaceZ - s_planeZ) > 64.0f) return false;
+    crossing.z = q.surfaceZ;
+
+    s_table.impacted[i] = true;
+    EmitProjectileImpact(proj, crossing, (prev.z - pos.z) / dt);
+    return false;
+}
+
+}  // namespace
+
+// ============================================================================
+// Public API
+// ============================================================================
+
+void RequestProjectileScan() {
+    if (!cfgProjectilesEnabled) return;
+    if (s_scanPending.exchange(true)) {
+        TelemetryAdd(TelemetryBlock().tasksCoalesced);
+        return;
+    }
+    if (!PostTask(TaskType::ProjectileScan, []() {
+        s_scanPending.store(false);
+        ScanProjectilesForWater();
+    }, []() { s_scanPending.store(false); })) {
+        s_scanPending.store(false);
+    }
+}
+
+void ScanProjectilesForWater() {
+    TelemetryStageTimer stageTimer(Telemetry::Stage::ProjectileScan);
+    if (!cfgProjectilesEnabled || g_suspendAllDetections.load() || g_gameLoadInProgress.load()) return;
+
+    auto player = RE::PlayerCharacter::GetSingleton();
+    auto manager = RE::Projectile::Manager::GetSingleton();
+    if (!player || !manager) return;
+
+    const long long nowMs = ProjectileNowMs();
+    ++s_frame;
+
+    const RE::NiPoint3 playerPos = player->GetPosition();
+    RefreshWaterPlane(playerPos, nowMs);
+    if (!s_planeValid) {
+        ClearTable();
+        return;
+    }
+
+    const float rangeSq = cfgProjectileRange * cfgProjectileRange;
+    int remaining = cfgProjectileScanCap;
+    {
+        RE::BSSpinLockGuard locker(manager->lock);
+        // One pass over limited then unlimited, starting where the cap stopped the previous scan
+        const std::size_t limitedCount = manager->limited.size();
+        const std::size_t total = limitedCount + manager->unlimited.size();
+        const std::size_t start = total > 0 ? s_cursor % total : 0;
+        bool cursorSet = false;
+        for (std::size_t k = 0; k < total; ++k) {
+            const std::size_t pos = (start + k) % total;
+            const RE::ProjectileHandle& h = pos < limitedCount ? manager->limited[static_cast<std::uint32_t>(pos)]
+                                                               : manager->unlimited[static_cast<std::uint32_t>(pos - limitedCount)];
+            if (VisitProjectile(h, playerPos, rangeSq, nowMs, remaining) && !cursorSet) {
+                s_cursor = pos;
+                cursorSet = true;
+            }
+        }
+        if (!cursorSet) s_cursor = 0;
+    }
+
+    PurgeStale();
+}
+
+void ResetProjectileTracking() {
+    ClearTable();
+    s_cursor = 0;
+    s_planeValid = false;
+    s_planeMs = 0;
+}
+
+ProjectileWaterStats GetProjectileWaterStats() {
+    ProjectileWaterStats st;
+    st.scanned = s_statScanned.load();
+    st.crossings = s_statCrossings.load();
+    st.capped = s_statCapped.load();
+    return st;
+}
+
+} // namespace InteractiveWaterVR
@@ -0,0 +1,35 @@
+#pragma once
+// water_projectiles.h - Arrow, bolt and spell projectile water impacts
+
+#include <RE/Skyrim.h>
+#include <cstdint>
+
+namespace InteractiveWaterVR {
+
+// ============================================================================
+// Projectile water impacts
+// ============================================================================
+
+// Active projectiles near the player are scanned once per frame, up to a hard cap; the scan resumes
+// where the cap stopped it, so over-cap projectiles take turns. The broad phase only tests whether
+// a projectile's segment since its previous visit crosses the cached water plane under the player;
+// crossings are confirmed with a water query at the crossing point.
+
+struct ProjectileWaterStats {
+    std::uint64_t scanned = 0;     // projectiles examined
+    std::uint64_t crossings = 0;   // confirmed downward surface crossings (impacts emitted)
+    std::uint64_t capped = 0;      // in-range projectiles left for a later frame by the per-frame cap
+};
+
+// Monitoring thread: post one coalesced main-thread scan if none is outstanding
+void RequestProjectileScan();
+
+// Main thread: scan active projectiles and emit impacts
+void ScanProjectilesForWater();
+
+// Forget tracked projectile segments (game load / state reset)
+void ResetProjectileTracking();
+
+ProjectileWaterStats GetProjectileWaterStats();
+
+} // namespace InteractiveWaterVR
@@ -4,15 +4,225 @@
 #include "water_state.h"
 #include "water_coll_det.h"
 #include "helper.h"
+#include "config.h"
+#include "telemetry.h"
+#include "event_trace.h"
+#include "main_thread_tasks.h"
+#include <algorithm>
+#include <array>
+#include <atomic>
 #include <chrono>
+#include <cmath>
+#include <mutex>
 
 namespace InteractiveWaterVR {
 
+// ============================================================================
+// Ripple accumulator
+// ============================================================================
+
+namespace {
+
+constexpr std::size_t kMaxPendingRipples = 64;
+// Frame-length window the budget is counted over; guards against two
+// flushes landing in the same frame when a task is posted mid-drain.
+constexpr long long kRippleBudgetWindowMs = 11;
+
+struct PendingRipple {
+    RE::NiPoint3 pos;
+    float amt = 0.0f;
+    RippleSource source = RippleSource::Wake;
+    long long firstMs = 0;
+};
+
+std::mutex s_rippleMutex;
+std::array<PendingRipple, kMaxPendingRipples> s_pending{};
+std::size_t s_pendingCount = 0;
+long long s_budgetWindowStartMs = 0;
+int s_budgetUsed = 0;
+
+std::atomic<bool> s_flushPending{ false };
+std::atomic<std::uint64_t> s_queued{ 0 };
+std::atomic<std::uint64_t> s_merged{ 0 };
+std::atomic<std::uint64_t> s_dropped{ 0 };
+std::atomic<std::uint64_t> s_emitted{ 0 };
+
+long long RippleNowMs() {
+    return std::chrono::duration_cast<std::chrono::milliseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+bool IsPriority(RippleSource s) {
+    return s != RippleSource::Wake;
+}
+
+}  // namespace
+
+void QueueRipple(RippleSource source, const RE::NiPoint3& p, float amt) {
+    if (g_suspendAllDetections.load()) return;
+    if (!(amt > 0.0f)) return;
+
+    s_queued.fetch_add(1);
+    const long long nowMs = RippleNowMs();
+    const float radius = std::max(0.0f, cfgRippleMergeRadius);
+    const float radiusSq = radius * radius;
+
+    std::lock_guard<std::mutex> lock(s_rippleMutex);
+
+    // Merge into a pending ripple of the same source that is still inside its window
+    for (std::size_t i = 0; i < s_pendingCount; ++i) {
+        PendingRipple& r = s_pending[i];
+        if (r.source != source) continue;
+        if (nowMs - r.firstMs > cfgRippleMergeWindowMs) continue;
+        const float dx = r.pos.x - p.x;
+        const float dy = r.pos.y - p.y;
+        if (dx * dx + dy * dy > radiusSq) continue;
+
+        // Amplitude-weighted centre, energy-summed amplitude
+        const float total = r.amt + amt;
+        r.pos.x = (r.pos.x * r.amt + p.x * amt) / total;
+        r.pos.y = (r.pos.y * r.amt + p.y * amt) / total;
+        r.pos.z = (r.pos.z * r.amt + p.z * amt) / total;
+        r.amt = std::sqrt(r.amt * r.amt + amt * amt);
+        s_merged.fetch_add(1);
+        TraceRipple(true, static_cast<unsigned>(source), amt);
+        return;
+    }
+
+    if (s_pendingCount >= kMaxPendingRipples) {
+        // Full: an entry/exit evicts the oldest wake, a wake is simply dropped
+        if (!IsPriority(source)) {
+            s_dropped.fetch_add(1);
+            return;
+        }
+        std::size_t victim = kMaxPendingRipples;
+        for (std::size_t i = 0; i < s_pendingCount; ++i) {
+            if (!IsPriority(s_pending[i].source) &&
+                (victim == kMaxPendingRipples || s_pending[i].firstMs < s_pending[victim].firstMs)) {
+                victim = i;
+            }
+        }
+        if (victim == kMaxPendingRipples) {
+            s_dropped.fetch_add(1);
+            return;
+        }
+        s_pending[victim] = s_pending[--s_pendingCount];
+        s_dropped.fetch_add(1);
+    }
+
+    PendingRipple& r = s_pending[s_pendingCount++];
+    r.pos = p;
+    r.amt = amt;
+    r.source = source;
+    r.firstMs = nowMs;
+}
+
+void FlushQueuedRipples() {
+    s_flushPending.store(false);
+    TelemetryStageTimer flushTimer(Telemetry::Stage::RippleFlush);
+
+    std::array<PendingRipple, kMaxPendingRipples> out;
+    std::size_t outCount = 0;
+    const long long nowMs = RippleNowMs();
+
+    {
+        std::lock_guard<std::mutex> lock(s_rippleMutex);
+        if (s_pendingCount == 0) return;
+
+        if (nowMs - s_budgetWindowStartMs >= kRippleBudgetWindowMs) {
+            s_budgetWindowStartMs = nowMs;
+            s_budgetUsed = 0;
+        }
+        int budget = std::max(0, cfgRippleBudgetPerFrame - s_budgetUsed);
+
+        // Entries/exits first: they are never held back, and whatever does
+        // not fit in this frame's budget is dropped rather than replayed late.
+        std::size_t keep = 0;
+        for (std::size_t i = 0; i < s_pendingCount; ++i) {
+            const PendingRipple& r = s_pending[i];
+            if (!IsPriority(r.source)) {
+                s_pending[keep++] = r;
+                continue;
+            }
+            if (budget > 0) {
+                out[outCount++] = r;
+                --budget;
+            } else {
+                s_dropped.fetch_add(1);
+            }
+        }
+        s_pendingCount = keep;
+
+        // Wakes whose merge window has closed, oldest first. Under frame
+        // pressure only a (1 - pressure) share of the remaining budget goes to wakes.
+        const int wakeBudget = std::min(budget,
+            static_cast<int>(std::ceil((1.0f - GetFramePressure()) * static_cast<float>(budget))));
+        int wakesLeft = wakeBudget;
+        std::sort(s_pending.begin(), s_pending.begin() + s_pendingCount,
+            [](const PendingRipple& a, const PendingRipple& b) { return a.firstMs < b.firstMs; });
+        keep = 0;
+        for (std::size_t i = 0; i < s_pendingCount; ++i) {
+            const PendingRipple& r = s_pending[i];
+            if (nowMs - r.firstMs < cfgRippleMergeWindowMs) {
+                s_pending[keep++] = r;
+            } else if (wakesLeft > 0) {
+                out[outCount++] = r;
+                --budget;
+                --wakesLeft;
+            } else {
+                s_dropped.fetch_add(1);
+                if (budget > 0) TelemetryAdd(TelemetryBlock().cosmeticThinned);
+            }
+        }
+        s_pendingCount = keep;
+        s_budgetUsed = cfgRippleBudgetPerFrame - budget;
+        TelemetrySet(TelemetryBlock().rippleQueueDepth, static_cast<std::uint32_t>(s_pendingCount));
+    }
+
+    if (outCount == 0 || g_gameLoadInProgress.load()) return;
+    auto ws = RE::TESWaterSystem::GetSingleton();
+    if (!ws) return;
+    for (std::size_t i = 0; i < outCount; ++i) {
+        ws->AddRipple(out[i].pos, out[i].amt);
+        TraceRipple(false, static_cast<unsigned>(out[i].source), out[i].amt);
+    }
+    s_emitted.fetch_add(outCount);
+}
+
+void PumpRippleQueue() {
+    {
+        std::lock_guard<std::mutex> lock(s_rippleMutex);
+        if (s_pendingCount == 0) return;
+    }
+    if (s_flushPending.exchange(true)) {
+        TelemetryAdd(TelemetryBlock().tasksCoalesced);
+        return;
+    }
+    if (!PostTask(TaskType::RippleFlush, []() { FlushQueuedRipples(); })) {
+        s_flushPending.store(false);
+    }
+}
+
+void ResetRippleQueue() {
+    std::lock_guard<std::mutex> lock(s_rippleMutex);
+    s_pendingCount = 0;
+    s_budgetUsed = 0;
+}
+
+RippleCounters GetRippleCounters() {
+    RippleCounters c;
+    c.queued = s_queued.load();
+    c.merged = s_merged.load();
+    c.dropped = s_dropped.load();
+    c.emitted = s_emitted.load();
+    return c;
+}
+
 // ============================================================================
 // Ripple emission
 // ============================================================================
 
-void EmitRipple(const RE::NiPoint3& p, float amt) {
+void EmitRipple(const RE::NiPoint3& p, float amt, RippleSource source) {
     if (g_suspendAllDetections.load()) return;
 
     // If frost-submerged flag is active, log it (spawn logic disabled)
@@ -20,22 +230,16 @@ void EmitRipple(const RE::NiPoint3& p, float amt) {
 IW_LOG_INFO("EmitRipple: MagicDamageFrost flag is active - spawn logic disabled");
     }
 
-    auto ws = RE::TESWaterSystem::GetSingleton();
-  if (ws) {
-        ws->AddRipple(p, amt);
-    }
+    QueueRipple(source, p, amt);
+    FlushQueuedRipples();
 }
 
 void EmitWakeRipple(bool isLeft, const RE::NiPoint3& p, float amt) {
-    if (g_suspendAllDetections.load()) return;
-    auto ws = RE::TESWaterSystem::GetSingleton();
-    if (ws) {
-        ws->AddRipple(p, amt);
-    }
+    QueueRipple(RippleSource::Wake, p, amt);
 }
 
 bool EmitRippleIfAllowed(bool isLeft, const RE::NiPoint3& p, float amt, 
-           bool force, int requireSubmergedState, const char* reason) {
+           bool force, int requireSubmergedState, const char* reason, RippleSource source) {
 // If forced, only allow if within short window after transition
     if (force) {
         auto nowMs = std::chrono::duration_cast<std::chrono::milliseconds>(
@@ -72,13 +276,13 @@ bool EmitRippleIfAllowed(bool isLeft, const RE::NiPoint3& p, float amt,
   }
     }
 
-    EmitRipple(p, amt);
+    EmitRipple(p, amt, source);
     return true;
 }
 
 bool EmitSplashIfAllowed(bool isLeft, const RE::NiPoint3& p, float amt,
-         bool force, int requireSubmergedState, const char* reason) {
-    return EmitRippleIfAllowed(isLeft, p, amt, force, requireSubmergedState, reason);
+         bool force, int requireSubmergedState, const char* reason, RippleSource source) {
+    return EmitRippleIfAllowed(isLeft, p, amt, force, requireSubmergedState, reason, source);
 }
 
 } // namespace InteractiveWaterVR
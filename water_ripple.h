@@ -2,28 +2,64 @@
 // water_ripple.h - Ripple emission for water collision detection
 
 #include <RE/Skyrim.h>
+#include <cstdint>
 
 namespace InteractiveWaterVR {
 
+// ============================================================================
+// Ripple accumulator
+// ============================================================================
+
+// Where a ripple came from. Entries and exits are time-critical and are
+// emitted first; wakes are held for the merge window and fill what is left
+// of the per-frame budget.
+enum class RippleSource : std::uint8_t {
+    Entry = 0,
+    Exit,
+    Wake
+};
+
+struct RippleCounters {
+    std::uint64_t queued = 0;
+    std::uint64_t merged = 0;
+    std::uint64_t dropped = 0;
+    std::uint64_t emitted = 0;
+};
+
+// Queue a ripple (any thread). Ripples of the same source within
+// cfgRippleMergeRadius are combined into one with energy-summed amplitude.
+void QueueRipple(RippleSource source, const RE::NiPoint3& p, float amt);
+
+// Main thread: emit due ripples, at most cfgRippleBudgetPerFrame per frame
+void FlushQueuedRipples();
+
+// Post a flush task if ripples are waiting and none is outstanding
+void PumpRippleQueue();
+
+// Drop everything pending (game load / state reset)
+void ResetRippleQueue();
+
+RippleCounters GetRippleCounters();
+
 // ============================================================================
 // Ripple emission
 // ============================================================================
 
-// Low-level ripple emission (just adds ripple to water system)
-void EmitRipple(const RE::NiPoint3& p, float amt);
+// Low-level ripple emission (queues and flushes immediately; main thread)
+void EmitRipple(const RE::NiPoint3& p, float amt, RippleSource source = RippleSource::Entry);
 
-// Wake ripple helper
+// Wake ripple helper (queues only; safe from the monitoring thread)
 void EmitWakeRipple(bool isLeft, const RE::NiPoint3& p, float amt);
 
 // Emit ripple if allowed by current state
 // Returns true if ripple was emitted
 bool EmitRippleIfAllowed(bool isLeft, const RE::NiPoint3& p, float amt, 
           bool force = false, int requireSubmergedState = -1,
-   const char* reason = nullptr);
+   const char* reason = nullptr, RippleSource source = RippleSource::Entry);
 
 // Splash wrapper (same as EmitRippleIfAllowed)
 bool EmitSplashIfAllowed(bool isLeft, const RE::NiPoint3& p, float amt,
       bool force = false, int requireSubmergedState = -1,
-        const char* reason = nullptr);
+        const char* reason = nullptr, RippleSource source = RippleSource::Entry);
 
 } // namespace InteractiveWaterVR
@@ -3,10 +3,17 @@
 #include "water_sound.h"
 #include "water_state.h"
 #include "water_utils.h"
+#include "water_splash_curve.h"
 #include "config.h"
+#include "telemetry.h"
+#include "event_trace.h"
+#include "main_thread_tasks.h"
 #include "helper.h"
-#include <thread>
+#include "worker_runtime.h"
+#include <algorithm>
+#include <atomic>
 #include <chrono>
+#include <cmath>
 
 namespace InteractiveWaterVR {
 
@@ -50,20 +57,13 @@ RE::BGSSoundDescriptorForm* LoadSplashExitSoundDescriptor(SplashBand band) {
 // Band selection
 // ============================================================================
 
+// The louder of the (up to two) crossfaded band sounds
 SplashBand GetSplashBandForDownSpeed(float downSpeed) {
-    if (downSpeed <= cfgSplashVeryLightMax) return SplashBand::VeryLight;
-    if (downSpeed <= cfgSplashLightMax) return SplashBand::Light;
-    if (downSpeed <= cfgSplashNormalMax) return SplashBand::Normal;
-    if (downSpeed <= cfgSplashHardMax) return SplashBand::Hard;
-    return SplashBand::VeryHard;
+    return EvaluateEntrySplash(downSpeed).DominantBand();
 }
 
 SplashBand GetExitSplashBandForUpSpeed(float upSpeed) {
-    if (upSpeed <= cfgSplashExitVeryLightMax) return SplashBand::VeryLight;
-    if (upSpeed <= cfgSplashExitLightMax) return SplashBand::Light;
-    if (upSpeed <= cfgSplashExitNormalMax) return SplashBand::Normal;
-    if (upSpeed <= cfgSplashExitHardMax) return SplashBand::Hard;
-    return SplashBand::VeryHard;
+    return EvaluateExitSplash(upSpeed).DominantBand();
 }
 
 // ============================================================================
@@ -80,9 +80,11 @@ uint32_t PlaySoundAtNode(RE::BGSSoundDescriptorForm* sound, RE::NiAVObject* node
 
     RE::BSSoundHandle handle;
     if (!audio->BuildSoundDataFromDescriptor(handle, static_cast<RE::BSISoundDescriptor*>(sound), 16)) {
+        TelemetryAdd(TelemetryBlock().soundsRejected);
         return 0;
     }
  if (handle.soundID == static_cast<uint32_t>(-1)) {
+        TelemetryAdd(TelemetryBlock().soundsRejected);
         return 0;
     }
 
@@ -91,11 +93,98 @@ uint32_t PlaySoundAtNode(RE::BGSSoundDescriptorForm* sound, RE::NiAVObject* node
     handle.SetVolume(volume);
     
     if (handle.Play()) {
+        TelemetryAdd(TelemetryBlock().soundsStarted);
+        TraceSoundVoice(handle.soundID, volume);
         return handle.soundID;
     }
+    TelemetryAdd(TelemetryBlock().soundsRejected);
+    TraceSoundVoice(0, volume);
     return 0;
 }
 
+namespace {
+
+// Below this weight the quieter band voice is inaudible next to the other one
+constexpr float kMinCrossfadeWeight = 0.05f;
+
+// Play a splash response: the band's sound alone, or both adjacent band sounds with an equal-power
+// crossfade near a boundary. The second voice is cosmetic; under frame pressure the dominant one
+// plays at full volume instead. Returns the dominant voice's sound id (0 if it did not start).
+uint32_t PlaySplashResponse(const SplashResponse& r, bool isExit, RE::NiAVObject* node, float volumeScale) {
+    auto load = isExit ? LoadSplashExitSoundDescriptor : LoadSplashSoundDescriptor;
+    const SplashBand next = static_cast<SplashBand>(static_cast<int>(r.band) + 1);
+    const float vol = r.vol * volumeScale;
+
+    if (r.blend <= kMinCrossfadeWeight) return PlaySoundAtNode(load(r.band), node, node->world.translate, vol);
+    if (r.blend >= 1.0f - kMinCrossfadeWeight) return PlaySoundAtNode(load(next), node, node->world.translate, vol);
+
+    const bool nextDominant = r.blend > 0.5f;
+    auto* dominant = load(nextDominant ? next : r.band);
+    auto* other = load(nextDominant ? r.band : next);
+    if (!other || !AdmitCosmetic()) return PlaySoundAtNode(dominant, node, node->world.translate, vol);
+    if (!dominant) return PlaySoundAtNode(other, node, node->world.translate, vol);
+
+    constexpr float kHalfPi = 1.5707963f;
+    const float gLow = std::cos(r.blend * kHalfPi);
+    const float gHigh = std::sin(r.blend * kHalfPi);
+    const uint32_t id = PlaySoundAtNode(dominant, node, node->world.translate, vol * (nextDominant ? gHigh : gLow));
+    PlaySoundAtNode(other, node, node->world.translate, vol * (nextDominant ? gLow : gHigh));
+    return id;
+}
+
+}  // namespace
+
+// ============================================================================
+// Entry splash pre-arm
+// ============================================================================
+
+namespace {
+
+// Time-to-contact window, in detection ticks, within which a hand's entry sounds are loaded
+constexpr float kPreArmTicks = 3.0f;
+
+std::atomic<std::uint32_t> s_entrySoundsLoaded{ 0 };  // bit per SplashBand, set on the main thread
+std::atomic<bool> s_preloadPending{ false };
+
+// Bands an entry at downSpeed plays: the band, and the next one when it is crossfaded in
+std::uint32_t EntryBandsFor(const SplashResponse& r) {
+    std::uint32_t bits = 0;
+    const int next = static_cast<int>(r.band) + 1;
+    if (r.blend < 1.0f - kMinCrossfadeWeight) bits |= 1u << static_cast<int>(r.band);
+    if (r.blend > kMinCrossfadeWeight && next < static_cast<int>(SplashBand::Count)) bits |= 1u << next;
+    return bits;
+}
+
+}  // namespace
+
+void PreArmEntrySplash(bool isLeft) {
+    const float ttc = (isLeft ? g_leftControllerTimeToContact : g_rightControllerTimeToContact).load();
+    const float windowSeconds = kPreArmTicks * static_cast<float>(std::max(1, cfgPollIntervalMs)) / 1000.0f;
+    if (ttc < 0.0f || ttc > windowSeconds) return;
+    // Too slow to splash: the entry will not play a sound at all
+    const float downSpeed = (isLeft ? g_leftControllerApproachSpeed : g_rightControllerApproachSpeed).load();
+    if (downSpeed < cfgEntryDownZThreshold) return;
+
+    const SplashResponse response = EvaluateEntrySplash(std::min(downSpeed, kMaxEntryDownSpeed));
+    const std::uint32_t bands = EntryBandsFor(response);
+    if ((s_entrySoundsLoaded.load() & bands) == bands) return;
+    if (s_preloadPending.exchange(true)) return;
+    if (!PostTask(TaskType::SoundPreload, [bands]() {
+        s_preloadPending.store(false);
+        std::uint32_t loaded = 0;
+        for (int b = 0; b < static_cast<int>(SplashBand::Count); ++b) {
+            if ((bands & (1u << b)) && LoadSplashSoundDescriptor(static_cast<SplashBand>(b))) loaded |= 1u << b;
+        }
+        s_entrySoundsLoaded.fetch_or(loaded);
+    }, []() { s_preloadPending.store(false); })) {
+        s_preloadPending.store(false);
+    }
+}
+
+void ResetSplashSoundPreload() {
+    s_entrySoundsLoaded.store(0);
+}
+
 void PlaySplashSoundForDownSpeed(bool isLeft, float downSpeed, bool requireMoving) {
     if (g_suspendAllDetections.load()) return;
 
@@ -115,24 +204,13 @@ void PlaySplashSoundForDownSpeed(bool isLeft, float downSpeed, bool requireMovin
       }
     }
 
-  SplashBand band = GetSplashBandForDownSpeed(downSpeed);
-    auto desc = LoadSplashSoundDescriptor(band);
-    if (!desc) return;
+    const SplashResponse response = EvaluateEntrySplash(downSpeed);
+    TraceBandChosen(false, static_cast<unsigned>(response.DominantBand()), downSpeed);
     
  auto node = GetPlayerHandNode(isLeft ? false : true);
     if (!node) return;
 
-    float vol = 0.2f;
-    switch (band) {
-      case SplashBand::VeryLight: vol = cfgSplashVeryLightVol; break;
-        case SplashBand::Light: vol = cfgSplashLightVol; break;
-        case SplashBand::Normal: vol = cfgSplashNormalVol; break;
-    case SplashBand::Hard: vol = cfgSplashHardVol; break;
-  case SplashBand::VeryHard: vol = cfgSplashVeryHardVol; break;
-      default: vol = 0.2f; break;
-    }
-
-    uint32_t id = PlaySoundAtNode(desc, node, node->world.translate, vol);
+    uint32_t id = PlaySplashResponse(response, false, node, 1.0f);
     if (id != 0) {
         long long nowMs = std::chrono::duration_cast<std::chrono::milliseconds>(
      std::chrono::steady_clock::now().time_since_epoch()).count();
@@ -145,10 +223,9 @@ void PlaySplashSoundForDownSpeed(bool isLeft, float downSpeed, bool requireMovin
       g_rightEntrySoundPlaying.store(true);
         }
 
-        // Clear playing flag after timeout
-     std::thread([isLeft]() {
+        // Clear playing flag after timeout (a session reset clears it itself)
+     ScheduleJob(JobType::SoundFlagTimer, std::chrono::milliseconds(kEntrySoundPlayingTimeoutMs), [isLeft]() -> JobDelay {
             try {
-   std::this_thread::sleep_for(std::chrono::milliseconds(kEntrySoundPlayingTimeoutMs));
   long long last = isLeft ? g_leftLastEntrySoundMs.load() : g_rightLastEntrySoundMs.load();
            long long now = std::chrono::duration_cast<std::chrono::milliseconds>(
     std::chrono::steady_clock::now().time_since_epoch()).count();
@@ -157,10 +234,29 @@ void PlaySplashSoundForDownSpeed(bool isLeft, float downSpeed, bool requireMovin
         else g_rightEntrySoundPlaying.store(false);
             }
           } catch (...) {}
-        }).detach();
+            return kJobDone;
+        });
     }
 }
 
+void PlayEntrySplashAtNode(RE::NiAVObject* node, float downSpeed, float volumeScale) {
+    if (g_suspendAllDetections.load()) return;
+    if (!node || volumeScale <= 0.0f) return;
+
+    const SplashResponse response = EvaluateEntrySplash(downSpeed);
+    TraceBandChosen(false, static_cast<unsigned>(response.DominantBand()), downSpeed);
+    PlaySplashResponse(response, false, node, volumeScale);
+}
+
+void PlayExitSplashAtNode(RE::NiAVObject* node, float upSpeed, float volumeScale) {
+    if (g_suspendAllDetections.load()) return;
+    if (!node || volumeScale <= 0.0f) return;
+
+    const SplashResponse response = EvaluateExitSplash(upSpeed);
+    TraceBandChosen(true, static_cast<unsigned>(response.DominantBand()), upSpeed);
+    PlaySplashResponse(response, true, node, volumeScale);
+}
+
 void PlayExitSoundForUpSpeed(bool isLeft, float upSpeed) {
     if (g_suspendAllDetections.load()) return;
     
@@ -169,23 +265,11 @@ void PlayExitSoundForUpSpeed(bool isLeft, float upSpeed) {
         return;
     }
     
-    SplashBand band = GetExitSplashBandForUpSpeed(upSpeed);
-    auto desc = LoadSplashExitSoundDescriptor(band);
-    if (!desc) return;
+    const SplashResponse response = EvaluateExitSplash(upSpeed);
+    TraceBandChosen(true, static_cast<unsigned>(response.DominantBand()), upSpeed);
     
     auto node = GetPlayerHandNode(isLeft ? false : true);
     if (!node) return;
-    
-    float vol = 0.2f;
-    switch (band) {
-    case SplashBand::VeryLight: vol = cfgSplashExitVeryLightVol; break;
-        case SplashBand::Light: vol = cfgSplashExitLightVol; break;
-        case SplashBand::Normal: vol = cfgSplashExitNormalVol; break;
- case SplashBand::Hard: vol = cfgSplashExitHardVol; break;
-        case SplashBand::VeryHard: vol = cfgSplashExitVeryHardVol; break;
- default: vol = 0.2f; break;
-    }
-    if (vol < 0.0f) vol = 0.0f;
 
     // Don't play if controller is still submerged
     if ((isLeft && g_leftSubmerged.load()) || (!isLeft && g_rightSubmerged.load())) {
@@ -202,7 +286,7 @@ void PlayExitSoundForUpSpeed(bool isLeft, float upSpeed) {
         }
     }
 
-    PlaySoundAtNode(desc, node, node->world.translate, vol);
+    PlaySplashResponse(response, true, node, 1.0f);
 }
 
 bool TryPlayWakeMoveSound(bool isLeft) {
@@ -222,6 +306,8 @@ bool TryPlayWakeMoveSound(bool isLeft) {
     }
 
     if (g_suspendAllDetections.load()) return false;
+    // Wake sounds are cosmetic: thinned along with wake ripples when frames run long
+    if (!AdmitCosmetic()) return false;
     
     auto node = GetPlayerHandNode(isLeft ? false : true);
     if (!node) return false;
@@ -13,6 +13,13 @@ namespace InteractiveWaterVR {
 RE::BGSSoundDescriptorForm* LoadSplashSoundDescriptor(SplashBand band);
 RE::BGSSoundDescriptorForm* LoadSplashExitSoundDescriptor(SplashBand band);
 
+// Monitoring thread: when a hand's published time to contact is within a few ticks, load the entry
+// splash sounds its approach speed will pick on the main thread now, so the splash task that
+// follows the entry does not pay for the form lookups
+void PreArmEntrySplash(bool isLeft);
+// Session reset: the descriptor caches were cleared, so forget which bands are preloaded
+void ResetSplashSoundPreload();
+
 // ============================================================================
 // Band selection
 // ============================================================================
@@ -29,6 +36,10 @@ uint32_t PlaySoundAtNode(RE::BGSSoundDescriptorForm* sound, RE::NiAVObject* node
 
 void PlaySplashSoundForDownSpeed(bool isLeft, float downSpeed, bool requireMoving = true);
 void PlayExitSoundForUpSpeed(bool isLeft, float upSpeed);
+// Entry splash at an arbitrary node (actors, thrown objects); band from downSpeed, volume scaled
+void PlayEntrySplashAtNode(RE::NiAVObject* node, float downSpeed, float volumeScale);
+// Exit splash at an arbitrary node (stroke releases); band from upSpeed on the exit curve
+void PlayExitSplashAtNode(RE::NiAVObject* node, float upSpeed, float volumeScale);
 bool TryPlayWakeMoveSound(bool isLeft);
 
 } // namespace InteractiveWaterVR
@@ -0,0 +1,255 @@
+// water_splash_curve.cpp - Continuous splash response (amplitude, volume, sound band) versus speed
+
+#include "water_splash_curve.h"
+#include "config.h"
+#include "helper.h"
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cmath>
+#include <vector>
+
+namespace InteractiveWaterVR {
+
+// ============================================================================
+// Lookup tables
+// ============================================================================
+
+namespace {
+
+// Nodes are spaced uniformly in sqrt(speed): splash speeds span two orders of magnitude (30 to
+// 4500+), and the low end, where hands actually move, gets most of the resolution.
+constexpr std::size_t kLutSize = 256;
+constexpr std::size_t kMaxKnots = 32;
+constexpr std::size_t kBandBoundaries = static_cast<std::size_t>(SplashBand::Count) - 1;
+
+struct SplashLut {
+    float sqrtSpeedToIndex = 0.0f;  // (kLutSize - 1) / sqrt(max speed)
+    std::array<float, kLutSize> amt{};
+    std::array<float, kLutSize> vol{};
+    std::array<float, kLutSize> band{};  // continuous band coordinate, 0 (VeryLight) .. 4 (VeryHard)
+};
+
+// Two buffers per kind: a rebuild fills the one readers are not using, then publishes it
+SplashLut s_entryLuts[2];
+SplashLut s_exitLuts[2];
+std::atomic<const SplashLut*> s_entryLut{ nullptr };
+std::atomic<const SplashLut*> s_exitLut{ nullptr };
+
+struct Knot {
+    float speed;
+    float value;
+};
+
+// "speed:value, speed:value, ..." sorted by speed; false if empty or malformed
+bool ParseCurve(const std::string& text, std::vector<Knot>& out) {
+    out.clear();
+    std::size_t pos = 0;
+    while (pos < text.size()) {
+        std::size_t comma = text.find(',', pos);
+        if (comma == std::string::npos) comma = text.size();
+        const std::string item = text.substr(pos, comma - pos);
+        pos = comma + 1;
+        if (item.find_first_not_of(" \t") == std::string::npos) continue;
+
+        const auto colon = item.find(':');
+        if (colon == std::string::npos) return false;
+        try {
+            const Knot k{ std::stof(item.substr(0, colon)), std::stof(item.substr(colon + 1)) };
+            if (!(k.speed >= 0.0f) || !std::isfinite(k.value)) return false;
+            out.push_back(k);
+        } catch (...) {
+            return false;
+        }
+        if (out.size() > kMaxKnots) return false;
+    }
+    if (out.empty()) return false;
+    std::sort(out.begin(), out.end(), [](const Knot& a, const Knot& b) { return a.speed < b.speed; });
+    for (std::size_t i = 1; i < out.size(); ++i) {
+        if (out[i].speed <= out[i - 1].speed) return false;
+    }
+    return true;
+}
+
+// The legacy bands as a curve: flat inside each band, stepping just past each upper bound
+// (the old selection used `speed <= max`)
+std::vector<Knot> StepCurve(const float (&bounds)[kBandBoundaries], const float (&values)[kBandBoundaries + 1]) {
+    std::vector<Knot> knots;
+    knots.push_back({ 0.0f, values[0] });
+    float prev = 0.0f;
+    for (std::size_t i = 0; i < kBandBoundaries; ++i) {
+        const float b = std::max(bounds[i], prev + 1e-3f);
+        knots.push_back({ b, values[i] });
+        knots.push_back({ b + std::max(1e-3f, b * 1e-4f), values[i + 1] });
+        prev = knots.back().speed;
+    }
+    return knots;
+}
+
+// Fritsch-Carlson tangents: the cubic between knots never overshoots, so a monotone knot list
+// stays monotone (no louder-at-lower-speed wiggles)
+std::vector<float> MonotoneTangents(const std::vector<Knot>& k) {
+    const std::size_t n = k.size();
+    std::vector<float> m(n, 0.0f);
+    if (n < 2) return m;
+    std::vector<float> d(n - 1);
+    for (std::size_t i = 0; i + 1 < n; ++i) {
+        d[i] = (k[i + 1].value - k[i].value) / (k[i + 1].speed - k[i].speed);
+    }
+    m[0] = d[0];
+    m[n - 1] = d[n - 2];
+    for (std::size_t i = 1; i + 1 < n; ++i) {
+        m[i] = (d[i - 1] * d[i] <= 0.0f) ? 0.0f : (d[i - 1] + d[i]) * 0.5f;
+    }
+    for (std::size_t i = 0; i + 1 < n; ++i) {
+        if (d[i] == 0.0f) {
+            m[i] = m[i + 1] = 0.0f;
+            continue;
+        }
+        const float a = m[i] / d[i];
+        const float b = m[i + 1] / d[i];
+        const float h = a * a + b * b;
+        if (h > 9.0f) {
+            const float t = 3.0f / std::sqrt(h);
+            m[i] = t * a * d[i];
+            m[i + 1] = t * b * d[i];
+        }
+    }
+    return m;
+}
+
+// Evaluate a knot list (flat beyond both ends); tangents empty = piecewise linear
+float EvalCurve(const std::vector<Knot>& k, const std::vector<float>& tangents, float speed) {
+    if (speed <= k.front().speed) return k.front().value;
+    if (speed >= k.back().speed) return k.back().value;
+    std::size_t i = 0;
+    while (speed > k[i + 1].speed) ++i;
+    const float h = k[i + 1].speed - k[i].speed;
+    const float t = (speed - k[i].speed) / h;
+    if (tangents.empty()) return k[i].value + t * (k[i + 1].value - k[i].value);
+    const float t2 = t * t;
+    const float t3 = t2 * t;
+    return (2.0f * t3 - 3.0f * t2 + 1.0f) * k[i].value + (t3 - 2.0f * t2 + t) * h * tangents[i] +
+           (-2.0f * t3 + 3.0f * t2) * k[i + 1].value + (t3 - t2) * h * tangents[i + 1];
+}
+
+// Continuous band coordinate: each boundary b adds a 0..1 ramp over [b / (1 + w), b * (1 + w)]
+// (a hard step at b when w is 0)
+float BandCoordinate(const float (&bounds)[kBandBoundaries], float crossfade, float speed) {
+    float c = 0.0f;
+    for (float b : bounds) {
+        if (crossfade <= 0.0f) {
+            c += speed > b ? 1.0f : 0.0f;
+            continue;
+        }
+        const float lo = b / (1.0f + crossfade);
+        const float hi = b * (1.0f + crossfade);
+        c += std::clamp((speed - lo) / (hi - lo), 0.0f, 1.0f);
+    }
+    return c;
+}
+
+struct CurveSettings {
+    const char* name;
+    const std::string& amtCurve;
+    const std::string& volCurve;
+    float bounds[kBandBoundaries];
+    float amts[kBandBoundaries + 1];
+    float vols[kBandBoundaries + 1];
+};
+
+void BakeLut(const CurveSettings& s, SplashLut& lut) {
+    std::vector<Knot> amtKnots, volKnots;
+    const bool amtFromCurve = ParseCurve(s.amtCurve, amtKnots);
+    const bool volFromCurve = ParseCurve(s.volCurve, volKnots);
+    if (!amtFromCurve) {
+        if (!s.amtCurve.empty()) IW_LOG_WARN("Splash curves: [%s] AmtCurve '%s' is invalid - using band amounts", s.name, s.amtCurve.c_str());
+        amtKnots = StepCurve(s.bounds, s.amts);
+    }
+    if (!volFromCurve) {
+        if (!s.volCurve.empty()) IW_LOG_WARN("Splash curves: [%s] VolCurve '%s' is invalid - using band volumes", s.name, s.volCurve.c_str());
+        volKnots = StepCurve(s.bounds, s.vols);
+    }
+
+    // Band step curves stay piecewise linear so they reproduce the old bands exactly between steps
+    const std::vector<float> amtTangents = cfgSplashCurveSmooth && amtFromCurve ? MonotoneTangents(amtKnots) : std::vector<float>{};
+    const std::vector<float> volTangents = cfgSplashCurveSmooth && volFromCurve ? MonotoneTangents(volKnots) : std::vector<float>{};
+
+    float maxSpeed = std::max({ amtKnots.back().speed, volKnots.back().speed, s.bounds[kBandBoundaries - 1] * (1.0f + cfgSplashSoundCrossfade) });
+    maxSpeed = std::max(1.0f, maxSpeed * 1.05f);
+    const float sqrtMax = std::sqrt(maxSpeed);
+    lut.sqrtSpeedToIndex = static_cast<float>(kLutSize - 1) / sqrtMax;
+
+    for (std::size_t j = 0; j < kLutSize; ++j) {
+        const float r = static_cast<float>(j) / static_cast<float>(kLutSize - 1) * sqrtMax;
+        const float speed = r * r;
+        lut.amt[j] = std::max(0.0f, EvalCurve(amtKnots, amtTangents, speed));
+        lut.vol[j] = std::max(0.0f, EvalCurve(volKnots, volTangents, speed));
+        lut.band[j] = BandCoordinate(s.bounds, cfgSplashSoundCrossfade, speed);
+    }
+
+    IW_LOG_INFO("Splash curves: [%s] amplitude from %s (%zu knots), volume from %s (%zu knots), range 0..%.0f",
+        s.name, amtFromCurve ? "AmtCurve" : "bands", amtKnots.size(), volFromCurve ? "VolCurve" : "bands", volKnots.size(), maxSpeed);
+}
+
+SplashResponse Evaluate(const std::atomic<const SplashLut*>& table, float speed) {
+    SplashResponse r;
+    const SplashLut* lut = table.load(std::memory_order_acquire);
+    if (!lut) return r;
+
+    const float x = std::sqrt(std::max(0.0f, speed)) * lut->sqrtSpeedToIndex;
+    float band = 0.0f;
+    if (x >= static_cast<float>(kLutSize - 1)) {
+        r.amt = lut->amt[kLutSize - 1];
+        r.vol = lut->vol[kLutSize - 1];
+        band = lut->band[kLutSize - 1];
+    } else {
+        const auto i = static_cast<std::size_t>(x);
+        const float t = x - static_cast<float>(i);
+        r.amt = lut->amt[i] + t * (lut->amt[i + 1] - lut->amt[i]);
+        r.vol = lut->vol[i] + t * (lut->vol[i + 1] - lut->vol[i]);
+        band = lut->band[i] + t * (lut->band[i + 1] - lut->band[i]);
+    }
+
+    const int last = static_cast<int>(SplashBand::Count) - 1;
+    const int lo = std::clamp(static_cast<int>(band), 0, last);
+    r.band = static_cast<SplashBand>(lo);
+    r.blend = lo < last ? std::clamp(band - static_cast<float>(lo), 0.0f, 1.0f) : 0.0f;
+    return r;
+}
+
+}  // namespace
+
+// ============================================================================
+// Public API
+// ============================================================================
+
+SplashResponse EvaluateEntrySplash(float downSpeed) {
+    return Evaluate(s_entryLut, downSpeed);
+}
+
+SplashResponse EvaluateExitSplash(float upSpeed) {
+    return Evaluate(s_exitLut, upSpeed);
+}
+
+void RebuildSplashCurves() {
+    const CurveSettings entrySettings{ "Splash", cfgSplashAmtCurve, cfgSplashVolCurve,
+        { cfgSplashVeryLightMax, cfgSplashLightMax, cfgSplashNormalMax, cfgSplashHardMax },
+        { cfgSplashVeryLightAmt, cfgSplashLightAmt, cfgSplashNormalAmt, cfgSplashHardAmt, cfgSplashVeryHardAmt },
+        { cfgSplashVeryLightVol, cfgSplashLightVol, cfgSplashNormalVol, cfgSplashHardVol, cfgSplashVeryHardVol } };
+    const CurveSettings exitSettings{ "SplashExit", cfgSplashExitAmtCurve, cfgSplashExitVolCurve,
+        { cfgSplashExitVeryLightMax, cfgSplashExitLightMax, cfgSplashExitNormalMax, cfgSplashExitHardMax },
+        { cfgSplashExitVeryLightAmt, cfgSplashExitLightAmt, cfgSplashExitNormalAmt, cfgSplashExitHardAmt, cfgSplashExitVeryHardAmt },
+        { cfgSplashExitVeryLightVol, cfgSplashExitLightVol, cfgSplashExitNormalVol, cfgSplashExitHardVol, cfgSplashExitVeryHardVol } };
+
+    // Rebuilds only happen when the INI changes, so a reader still holding the previous table has
+    // long finished with it before that buffer is reused
+    SplashLut* entryLut = s_entryLut.load(std::memory_order_relaxed) == &s_entryLuts[0] ? &s_entryLuts[1] : &s_entryLuts[0];
+    SplashLut* exitLut = s_exitLut.load(std::memory_order_relaxed) == &s_exitLuts[0] ? &s_exitLuts[1] : &s_exitLuts[0];
+    BakeLut(entrySettings, *entryLut);
+    BakeLut(exitSettings, *exitLut);
+    s_entryLut.store(entryLut, std::memory_order_release);
+    s_exitLut.store(exitLut, std::memory_order_release);
+}
+
+} // namespace InteractiveWaterVR
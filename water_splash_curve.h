@@ -0,0 +1,42 @@
+#pragma once
+// water_splash_curve.h - Continuous splash response (amplitude, volume, sound band) versus speed
+
+#include "water_state.h"
+#include <string>
+
+namespace InteractiveWaterVR {
+
+// ============================================================================
+// Response
+// ============================================================================
+
+// What an entry or exit at a given speed produces. Near a band boundary the two adjacent band
+// sounds are crossfaded: `band` plays with weight (1 - blend), `band + 1` with weight blend.
+struct SplashResponse {
+    float amt = 0.0f;     // ripple amplitude before cfgSplashScale
+    float vol = 0.0f;     // sound volume
+    SplashBand band = SplashBand::VeryLight;
+    float blend = 0.0f;   // 0 = only `band`, 1 = only the next band
+
+    SplashBand DominantBand() const {
+        return blend > 0.5f ? static_cast<SplashBand>(static_cast<int>(band) + 1) : band;
+    }
+};
+
+// Single table interpolation; safe from any thread
+SplashResponse EvaluateEntrySplash(float downSpeed);
+SplashResponse EvaluateExitSplash(float upSpeed);
+
+// ============================================================================
+// Baking
+// ============================================================================
+
+// Rebuild both lookup tables from the [Splash] / [SplashExit] settings. Called by loadConfig after
+// the file has been (re)parsed.
+//
+// Curves are "speed:value" knot lists, e.g. AmtCurve = 0:0.01, 60:0.02, 1500:0.03, 4500:0.07.
+// When a curve key is empty or invalid, the band keys (VeryLightMax.. / VeryLightAmt.. / ..Vol)
+// are used as a step curve, which reproduces the old five-band behaviour.
+void RebuildSplashCurves();
+
+} // namespace InteractiveWaterVR
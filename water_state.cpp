@@ -4,6 +4,17 @@
 #include "water_coll_det.h"
 #include "helper.h"
 #include "equipped_spell_interaction.h"
+#include "config.h"
+#include "water_ripple.h"
+#include "water_actor_grid.h"
+#include "water_thrown_objects.h"
+#include "water_projectiles.h"
+#include "water_higgs_velocity.h"
+#include "event_trace.h"
+#include "ref_spawn.h"
+#include "worker_runtime.h"
+#include "main_thread_tasks.h"
+#include "water_sound.h"
 
 namespace InteractiveWaterVR {
 
@@ -32,13 +43,13 @@ const std::uint32_t kSplashExitFormBaseIDs[static_cast<size_t>(SplashBand::Count
 // ============================================================================
 
 std::atomic<bool> g_running{false};
-std::thread g_monitorThread;
 
 // ============================================================================
 // Game load state
 // ============================================================================
 
 std::atomic<bool> g_gameLoadInProgress{false};
+std::atomic<long long> g_loadFinishedMs{0};
 
 // ============================================================================
 // Detection flags
@@ -120,6 +131,8 @@ std::atomic<float> g_prevPlayerDepth{0.0f};
 
 std::atomic<float> g_leftControllerDepth{0.0f};
 std::atomic<float> g_rightControllerDepth{0.0f};
+std::atomic<float> g_leftHandSubmergedFraction{0.0f};
+std::atomic<float> g_rightHandSubmergedFraction{0.0f};
 
 // ============================================================================
 // Spell submerged logging flags
@@ -137,6 +150,39 @@ RE::BGSSoundDescriptorForm* g_splashExitSounds[static_cast<size_t>(SplashBand::C
 RE::BGSSoundDescriptorForm* g_wakeMoveSoundDesc = nullptr;
 RE::BGSMovableStatic* g_frostSpawnForm = nullptr;
 
+// ============================================================================
+// Motion filter parameters
+// ============================================================================
+
+MotionFilterParams GetProbeFilterParams()
+{
+    MotionFilterParams p{};
+    p.minCutoffHz = cfgFilterMinCutoff;
+    p.beta = cfgFilterBeta;
+    p.derivCutoffHz = cfgFilterDerivCutoff;
+    p.jitterSpeed = cfgJitterThresholdAdjusted;
+    p.teleportSpeed = kProbeTeleportSpeed;
+    return p;
+}
+
+DetectionParams GetDetectionParams()
+{
+    DetectionParams p{};
+    p.filter = GetProbeFilterParams();
+    p.movingThreshold = cfgMovingThresholdAdjusted;
+    p.movingConfirmSeconds = cfgMovingConfirmSeconds;
+    p.stationarySeconds = kStationaryConfirmSeconds;
+    p.entryMinDownSpeed = cfgEntryDownZThreshold;
+    p.entryMaxDownSpeed = kMaxEntryDownSpeed;
+    p.exitMinUpSpeed = cfgExitUpZThreshold;
+    p.exitMaxUpSpeed = kMaxExitUpSpeed;
+    p.minWakeDepth = kMinWakeDepthMeters;
+    p.wakeSpawnMs = cfgWakeSpawnMs;
+    p.wakeTrailSpacing = cfgWakeTrailSpacing;
+    p.wakeTrailMaxRipples = cfgWakeTrailMaxRipples;
+    return p;
+}
+
 // ============================================================================
 // State reset function
 // ============================================================================
@@ -147,12 +193,25 @@ void ResetAllWaterState()
     
     // Clear spell interaction cached forms first
     ClearSpellInteractionCachedForms();
+    // Tweens, despawns and flag timers from the previous session stop where they are
+    CancelSessionJobs("ResetAllWaterState");
+    // Main-thread work deferred under frame pressure still captures previous-session refs
+    ResetDeferredTasks();
+
+    // Drop ripples queued against the previous cell
+    ResetRippleQueue();
+    ResetSpawnQueue();
+    ResetActorWaterState();
+    ResetThrownObjects();
+    ResetProjectileTracking();
+    ResetHiggsVelocity();
     
     // Clear splash sound caches
     for (size_t i = 0; i < static_cast<size_t>(SplashBand::Count); ++i) {
         g_splashSounds[i] = nullptr;
         g_splashExitSounds[i] = nullptr;
  }
+    ResetSplashSoundPreload();
     
     // Clear other cached forms
     g_wakeMoveSoundDesc = nullptr;
@@ -188,7 +247,7 @@ void ResetAllWaterState()
     // Detection must be ENABLED by default
     g_leftDetectionActive.store(true);
     g_rightDetectionActive.store(true);
-  g_suspendAllDetections.store(false);
+  if (g_suspendAllDetections.exchange(false)) TraceSuspension(false, Trace::SuspendReason::Reset);
     g_suspendDueToDepthSneak.store(false);
     
     // Reset sound handles
@@ -215,6 +274,8 @@ void ResetAllWaterState()
     // Reset depth tracking
     g_leftControllerDepth.store(0.0f);
     g_rightControllerDepth.store(0.0f);
+    g_leftHandSubmergedFraction.store(0.0f);
+    g_rightHandSubmergedFraction.store(0.0f);
     g_prevPlayerDepth.store(0.0f);
     g_lastPlayerDepthLogMs.store(0);
     
@@ -223,6 +284,10 @@ void ResetAllWaterState()
     g_rightControllerHoveringAboveWater.store(false);
     g_leftControllerHoverHeight.store(0.0f);
     g_rightControllerHoverHeight.store(0.0f);
+    g_leftControllerApproachSpeed.store(0.0f);
+    g_rightControllerApproachSpeed.store(0.0f);
+    g_leftControllerTimeToContact.store(-1.0f);
+    g_rightControllerTimeToContact.store(-1.0f);
     
  // Reset sneak/swim state
     g_prevPlayerSwimming.store(false);
@@ -249,5 +314,9 @@ std::atomic<bool> g_leftControllerHoveringAboveWater{false};
 std::atomic<bool> g_rightControllerHoveringAboveWater{false};
 std::atomic<float> g_leftControllerHoverHeight{0.0f};
 std::atomic<float> g_rightControllerHoverHeight{0.0f};
+std::atomic<float> g_leftControllerApproachSpeed{0.0f};
+std::atomic<float> g_rightControllerApproachSpeed{0.0f};
+std::atomic<float> g_leftControllerTimeToContact{-1.0f};
+std::atomic<float> g_rightControllerTimeToContact{-1.0f};
 
 } // namespace InteractiveWaterVR
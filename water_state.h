@@ -8,6 +8,8 @@
 #include <deque>
 #include <SKSE/SKSE.h>
 #include <RE/Skyrim.h>
+#include "motion_filter.h"
+#include "detection_core.h"
 
 namespace InteractiveWaterVR {
 
@@ -15,19 +17,10 @@ namespace InteractiveWaterVR {
 // Constants
 // ============================================================================
 
-// Hardcoded maximum speeds (m/s) beyond which entries/exits are ignored
-constexpr float kMaxEntryDownSpeed = 1500.0f;
-constexpr float kMaxExitUpSpeed = 900.0f;
-
-// Polling interval (ms)
-constexpr int kPollIntervalMs = 6;
-
 // Movement detection thresholds (m/s)
 constexpr float kStationaryThreshold = 1.0f;
 constexpr float kMovingThreshold = 0.1f;
 constexpr float kJitterThreshold = 0.03f;
-constexpr float kMaxValidSpeed = 60.0f;
-constexpr float kStationaryConfirmSeconds = 1.5f;
 
 // Player depth logging
 constexpr long long kPlayerDepthLogIntervalMs = 1000;
@@ -40,7 +33,19 @@ constexpr float kPlayerDepthSneakShutdownMeters = 65.0f;
 
 // Ripple timing
 constexpr long long kForcedRippleWindowMs = 250;
-constexpr float kMinWakeDepthMeters = 2.0f;
+// Wake amplitude fades from full at kWakeFadeStartDepth to kWakeFadeMinScale at kWakeFadeEndDepth (game units of hand depth)
+constexpr float kWakeFadeStartDepth = 10.0f;
+constexpr float kWakeFadeEndDepth = 40.0f;
+constexpr float kWakeFadeMinScale = 0.25f;
+// Foot probes: run while the surface is at most this far below the player's root (feet lifted mid-step)
+constexpr float kFootProbeAboveSurface = 20.0f;
+// Water depth at the root giving a full-size footstep splash
+constexpr float kFootFullSplashDepth = 30.0f;
+constexpr long long kFootSplashCooldownMs = 200;
+// Horizontal foot speed (units/s) above which a submerged foot leaves a wake
+constexpr float kFootWakeSpeed = 40.0f;
+// Swim strokes: hands deeper than this at the catch/release are below any visible surface effect
+constexpr float kStrokeSurfaceDepth = 30.0f;
 constexpr float kFrostSurfaceDepthTolerance = 6.0f;
 
 // Sound timing
@@ -83,18 +88,25 @@ struct Sample {
     std::chrono::steady_clock::time_point t;
 };
 
+// Build the motion filter parameters from the current configuration
+MotionFilterParams GetProbeFilterParams();
+
+// Build the hand entry/exit/wake decision parameters from the current configuration
+DetectionParams GetDetectionParams();
+
 // ============================================================================
 // Thread and running state
 // ============================================================================
 
 extern std::atomic<bool> g_running;
-extern std::thread g_monitorThread;
 
 // ============================================================================
 // Game load state
 // ============================================================================
 
 extern std::atomic<bool> g_gameLoadInProgress;
+// steady_clock ms at which the last load finished (0 once the first detection tick has reported it)
+extern std::atomic<long long> g_loadFinishedMs;
 
 // ============================================================================
 // Detection flags
@@ -177,6 +189,10 @@ extern std::atomic<float> g_prevPlayerDepth;
 extern std::atomic<float> g_leftControllerDepth;
 extern std::atomic<float> g_rightControllerDepth;
 
+// Weighted fraction (0..1) of the hand + fingertip probes that are under the surface
+extern std::atomic<float> g_leftHandSubmergedFraction;
+extern std::atomic<float> g_rightHandSubmergedFraction;
+
 // ============================================================================
 // Spell submerged flags (declared extern in water_coll_det.h, defined here)
 // ============================================================================
@@ -207,6 +223,11 @@ extern std::atomic<bool> g_leftControllerHoveringAboveWater;
 extern std::atomic<bool> g_rightControllerHoveringAboveWater;
 extern std::atomic<float> g_leftControllerHoverHeight;
 extern std::atomic<float> g_rightControllerHoverHeight;
+// Closing speed toward the surface (units/s, positive = descending) and predicted seconds to contact (-1 = none)
+extern std::atomic<float> g_leftControllerApproachSpeed;
+extern std::atomic<float> g_rightControllerApproachSpeed;
+extern std::atomic<float> g_leftControllerTimeToContact;
+extern std::atomic<float> g_rightControllerTimeToContact;
 
 // Hover detection threshold - how high above water surface to detect
 constexpr float kHoverDetectionMaxHeight = 30.0f;  // Max height above water to consider "hovering"
@@ -0,0 +1,82 @@
+// water_stroke.cpp - Swim stroke recognition from the per-hand sample stream
+
+#include "water_stroke.h"
+#include <algorithm>
+
+namespace InteractiveWaterVR {
+
+// ============================================================================
+// StrokeRecognizer
+// ============================================================================
+
+void StrokeRecognizer::Reset() {
+    _event = StrokeEvent{};
+    _phase = StrokePhase::Idle;
+    _phaseSeconds = 0.0f;
+    _peakPullSpeed = 0.0f;
+    _recoveryLeftWater = false;
+}
+
+void StrokeRecognizer::Catch(float pullSpeed, const RE::NiPoint3& surfacePoint) {
+    _event.caught = true;
+    _event.caughtFromAir = _recoveryLeftWater;
+    _event.speed = pullSpeed;
+    _event.surfacePoint = surfacePoint;
+    _phase = StrokePhase::Pull;
+    _phaseSeconds = 0.0f;
+    _peakPullSpeed = pullSpeed;
+}
+
+const StrokeEvent& StrokeRecognizer::Update(float forwardSpeed, bool submerged, const RE::NiPoint3& surfacePoint,
+                                            float dt, const StrokeParams& params) {
+    _event = StrokeEvent{};
+    _phaseSeconds += std::max(0.0f, dt);
+
+    const bool forward = forwardSpeed > params.speedThreshold;
+    const bool backward = forwardSpeed < -params.speedThreshold;
+
+    switch (_phase) {
+        case StrokePhase::Idle:
+            if (forward) {
+                _phase = StrokePhase::Recovery;
+                _phaseSeconds = 0.0f;
+                _recoveryLeftWater = !submerged;
+            } else if (backward && submerged) {
+                // Cycles may start straight into a pull
+                _recoveryLeftWater = false;
+                Catch(-forwardSpeed, surfacePoint);
+            }
+            break;
+
+        case StrokePhase::Recovery:
+            if (!submerged) _recoveryLeftWater = true;
+            // Backward through the air is the arm coming round, not a catch
+            if (backward && submerged) {
+                Catch(-forwardSpeed, surfacePoint);
+            } else if (_phaseSeconds > params.maxCycleSeconds) {
+                _phase = StrokePhase::Idle;
+            }
+            break;
+
+        case StrokePhase::Pull:
+            _peakPullSpeed = std::max(_peakPullSpeed, -forwardSpeed);
+            if (forward || !submerged) {
+                // Release: the hand turned forward again or came out of the water
+                if (_phaseSeconds >= params.minPullSeconds) {
+                    _event.released = true;
+                    _event.speed = _peakPullSpeed;
+                    _event.surfacePoint = surfacePoint;
+                    ++_strokes;
+                }
+                _phase = StrokePhase::Recovery;
+                _phaseSeconds = 0.0f;
+                _recoveryLeftWater = !submerged;
+            } else if (_phaseSeconds > params.maxCycleSeconds) {
+                _phase = StrokePhase::Idle;
+            }
+            break;
+    }
+    return _event;
+}
+
+} // namespace InteractiveWaterVR
@@ -0,0 +1,64 @@
+#pragma once
+// water_stroke.h - Swim stroke recognition from the per-hand sample stream
+
+#include <RE/Skyrim.h>
+#include <cstdint>
+
+namespace InteractiveWaterVR {
+
+// ============================================================================
+// Parameters and events
+// ============================================================================
+
+struct StrokeParams {
+    float speedThreshold = 40.0f;   // hysteresis band on the body-relative forward speed (units/s)
+    float minPullSeconds = 0.12f;   // shorter backward motions are jitter, not a pull
+    float maxCycleSeconds = 3.0f;   // no catch or release for this long ends the cycle
+};
+
+struct StrokeEvent {
+    bool caught = false;            // a pull started this sample (the catch)
+    bool released = false;          // a pull ended this sample: one full stroke
+    bool caughtFromAir = false;     // catch: the recovery brought the hand out of the water
+    float speed = 0.0f;             // catch: hand speed at the catch; release: peak pull speed (units/s)
+    RE::NiPoint3 surfacePoint{};    // surface point above the hand when the event fired
+};
+
+enum class StrokePhase : std::uint8_t {
+    Idle = 0,   // no stroke cycle in progress
+    Recovery,   // hand travelling forward (in or above the water)
+    Pull        // hand travelling backward through the water
+};
+
+// ============================================================================
+// Recognizer
+// ============================================================================
+
+// One per hand. Each sample is the hand's filtered velocity relative to the player, projected on
+// the player's heading (positive = forward), plus whether the hand is under the surface.
+// A stroke is recovery -> catch (forward/backward zero crossing while submerged) -> pull ->
+// release (backward/forward crossing, or the hand leaving the water). Crossings use a hysteresis
+// band so filter noise around zero does not count. O(1) per sample, no allocation.
+class StrokeRecognizer {
+public:
+    void Reset();
+
+    const StrokeEvent& Update(float forwardSpeed, bool submerged, const RE::NiPoint3& surfacePoint, float dt,
+                              const StrokeParams& params);
+
+    StrokePhase Phase() const { return _phase; }
+    bool InCycle() const { return _phase != StrokePhase::Idle; }
+    std::uint32_t Strokes() const { return _strokes; }
+
+private:
+    void Catch(float pullSpeed, const RE::NiPoint3& surfacePoint);
+
+    StrokeEvent _event;
+    StrokePhase _phase = StrokePhase::Idle;
+    float _phaseSeconds = 0.0f;
+    float _peakPullSpeed = 0.0f;
+    bool _recoveryLeftWater = false;
+    std::uint32_t _strokes = 0;
+};
+
+} // namespace InteractiveWaterVR
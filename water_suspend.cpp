@@ -0,0 +1,172 @@
+// water_suspend.cpp - Engine-event-driven suspension of the worker runtime (menus, loading, game load)
+
+#include "water_suspend.h"
+#include "water_coll_det.h"
+#include "worker_runtime.h"
+#include "event_trace.h"
+#include "helper.h"
+#include <RE/Skyrim.h>
+#include <SKSE/SKSE.h>
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace InteractiveWaterVR {
+
+// ============================================================================
+// Suspension state
+// ============================================================================
+
+namespace {
+
+std::mutex s_mutex;
+std::uint32_t s_sources = 0;                       // one bit per MonitorSuspendSource
+std::chrono::steady_clock::time_point s_suspendedSince;
+std::vector<std::string> s_openPausingMenus;       // pausing menus opened since the sinks were registered
+
+const char* SourceName(MonitorSuspendSource source) {
+    switch (source) {
+        case MonitorSuspendSource::Menu: return "menu";
+        case MonitorSuspendSource::LoadingScreen: return "loading screen";
+        case MonitorSuspendSource::GameLoad: return "game load";
+        default: return "?";
+    }
+}
+
+Trace::SuspendReason TraceReason(MonitorSuspendSource source) {
+    switch (source) {
+        case MonitorSuspendSource::Menu: return Trace::SuspendReason::Menu;
+        case MonitorSuspendSource::LoadingScreen: return Trace::SuspendReason::LoadingScreen;
+        default: return Trace::SuspendReason::GameLoad;
+    }
+}
+
+// The runtime is paused on the first source and resumed with the last; sources in between only
+// change the mask
+void SetSourceLocked(MonitorSuspendSource source, bool suspended) {
+    const std::uint32_t bit = 1u << static_cast<std::uint32_t>(source);
+    const std::uint32_t before = s_sources;
+    s_sources = suspended ? (before | bit) : (before & ~bit);
+    if (s_sources == before) return;
+
+    TraceSuspension(suspended, TraceReason(source));
+    if (before == 0) {
+        PauseJobs();
+        s_suspendedSince = std::chrono::steady_clock::now();
+        IW_LOG_INFO("Suspension: workers paused (%s)", SourceName(source));
+    } else if (s_sources == 0) {
+        // Samples from before the pause would turn the gap into velocity
+        ResetWaterMonitorHistory();
+        ResumeJobs();
+        const auto pausedMs = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - s_suspendedSince).count();
+        IW_LOG_INFO("Suspension: workers resumed after %.0f ms (%s ended)", pausedMs, SourceName(source));
+    }
+}
+
+// A close event can be missed across a load (the menu is torn down with the old session); drop
+// the menus the UI no longer shows
+void PruneClosedMenusLocked() {
+    auto ui = RE::UI::GetSingleton();
+    if (!ui) return;
+    std::erase_if(s_openPausingMenus, [ui](const std::string& name) { return !ui->IsMenuOpen(name); });
+    SetSourceLocked(MonitorSuspendSource::Menu, !s_openPausingMenus.empty());
+}
+
+}  // namespace
+
+void SetMonitorSuspended(MonitorSuspendSource source, bool suspended) {
+    std::lock_guard<std::mutex> lock(s_mutex);
+    SetSourceLocked(source, suspended);
+    if (source == MonitorSuspendSource::GameLoad && !suspended) PruneClosedMenusLocked();
+}
+
+// ============================================================================
+// Event sinks
+// ============================================================================
+
+namespace {
+
+class SuspensionEventSink :
+    public RE::BSTEventSink<RE::MenuOpenCloseEvent>,
+    public RE::BSTEventSink<RE::TESFastTravelEndEvent>,
+    public RE::BSTEventSink<RE::BGSActorCellEvent>
+{
+public:
+    static SuspensionEventSink* GetSingleton() {
+        static SuspensionEventSink singleton;
+        return &singleton;
+    }
+
+    // Only menus that pause the game suspend; HUD and other always-open menus come and go constantly
+    RE::BSEventNotifyControl ProcessEvent(const RE::MenuOpenCloseEvent* a_event, RE::BSTEventSource<RE::MenuOpenCloseEvent>*) override {
+        if (!a_event) return RE::BSEventNotifyControl::kContinue;
+        const std::string_view name = a_event->menuName.c_str();
+        if (name == RE::LoadingMenu::MENU_NAME) {
+            SetMonitorSuspended(MonitorSuspendSource::LoadingScreen, a_event->opening);
+            return RE::BSEventNotifyControl::kContinue;
+        }
+        if (a_event->opening) {
+            auto ui = RE::UI::GetSingleton();
+            auto menu = ui ? ui->GetMenu(name) : nullptr;
+            if (!menu || !menu->PausesGame()) return RE::BSEventNotifyControl::kContinue;
+        }
+
+        std::lock_guard<std::mutex> lock(s_mutex);
+        auto it = std::find(s_openPausingMenus.begin(), s_openPausingMenus.end(), name);
+        if (a_event->opening) {
+            if (it == s_openPausingMenus.end()) s_openPausingMenus.emplace_back(name);
+        } else {
+            if (it == s_openPausingMenus.end()) return RE::BSEventNotifyControl::kContinue;
+            s_openPausingMenus.erase(it);
+        }
+        SetSourceLocked(MonitorSuspendSource::Menu, !s_openPausingMenus.empty());
+        return RE::BSEventNotifyControl::kContinue;
+    }
+
+    // The loading screen already suspended the trip; the arrival point has nothing to do with the
+    // samples taken before it
+    RE::BSEventNotifyControl ProcessEvent(const RE::TESFastTravelEndEvent* a_event, RE::BSTEventSource<RE::TESFastTravelEndEvent>*) override {
+        if (a_event) {
+            ResetWaterMonitorHistory();
+            IW_LOG_INFO("Suspension: fast travel ended - monitor sample history reset");
+        }
+        return RE::BSEventNotifyControl::kContinue;
+    }
+
+    // Doors, teleports and scripted moves change the cell without a meaningful velocity in between
+    RE::BSEventNotifyControl ProcessEvent(const RE::BGSActorCellEvent* a_event, RE::BSTEventSource<RE::BGSActorCellEvent>*) override {
+        if (a_event && a_event->flags.get() == RE::BGSActorCellEvent::CellFlag::kEnter) {
+            ResetWaterMonitorHistory();
+        }
+        return RE::BSEventNotifyControl::kContinue;
+    }
+};
+
+std::atomic<bool> s_sinksRegistered{ false };
+
+}  // namespace
+
+void RegisterSuspensionSinks() {
+    if (s_sinksRegistered.exchange(true)) return;
+    auto sink = SuspensionEventSink::GetSingleton();
+
+    auto ui = RE::UI::GetSingleton();
+    auto holder = RE::ScriptEventSourceHolder::GetSingleton();
+    auto player = RE::PlayerCharacter::GetSingleton();
+    if (!ui || !holder || !player) {
+        IW_LOG_WARN("RegisterSuspensionSinks: event sources not available (ui=%d holder=%d player=%d) - menus will not suspend the monitor",
+            ui != nullptr, holder != nullptr, player != nullptr);
+        s_sinksRegistered.store(false);
+        return;
+    }
+    ui->AddEventSink<RE::MenuOpenCloseEvent>(sink);
+    holder->AddEventSink<RE::TESFastTravelEndEvent>(sink);
+    player->AsBGSActorCellEventSource()->AddEventSink(sink);
+    IW_LOG_INFO("RegisterSuspensionSinks: listening for menus, loading screens, fast travel and cell changes");
+}
+
+} // namespace InteractiveWaterVR
@@ -0,0 +1,33 @@
+#pragma once
+// water_suspend.h - Engine-event-driven suspension of the worker runtime (menus, loading, game load)
+
+#include <cstdint>
+
+namespace InteractiveWaterVR {
+
+// ============================================================================
+// Suspension sources
+// ============================================================================
+
+enum class MonitorSuspendSource : std::uint8_t {
+    Menu = 0,        // a menu that pauses the game is open
+    LoadingScreen,   // the loading menu is open (cell transitions, fast travel)
+    GameLoad,        // between kPreLoadGame / reset and kPostLoadGame / kNewGame
+    Count
+};
+
+// While any source is set the worker runtime is paused: the water monitor, spell monitor, tweens
+// and timers do not run and the workers block on their condition variable. When the last source
+// clears, the runtime resumes and the monitor's next tick starts from fresh samples.
+void SetMonitorSuspended(MonitorSuspendSource source, bool suspended);
+
+// ============================================================================
+// Event sinks
+// ============================================================================
+
+// Menu open/close (UI), fast travel end and player cell change. Fast travel end and cell change do
+// not suspend anything; they drop the monitor's sample history because the player was moved.
+// Idempotent; call once the game data is loaded.
+void RegisterSuspensionSinks();
+
+} // namespace InteractiveWaterVR
@@ -0,0 +1,217 @@
+// water_thrown_objects.cpp - Splashes for objects the player drops or throws (HIGGS)
+
+#include "water_thrown_objects.h"
+#include "water_state.h"
+#include "water_utils.h"
+#include "water_ripple.h"
+#include "water_sound.h"
+#include "higgsinterface.h"
+#include "helper.h"
+#include "config.h"
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cmath>
+
+namespace InteractiveWaterVR {
+
+// ============================================================================
+// Constants
+// ============================================================================
+
+namespace {
+
+constexpr std::size_t kMaxThrownObjects = 32;
+// Give up on an object after this long even if it never settles (rolling down a slope, etc.)
+constexpr float kThrownTimeoutSeconds = 10.0f;
+// Below this speed (units/s) for kRestSeconds the object is considered at rest
+constexpr float kRestSpeed = 5.0f;
+constexpr float kRestSeconds = 0.5f;
+// Weight used when the base form carries none (misc clutter, some activators)
+constexpr float kDefaultObjectWeight = 1.0f;
+
+// ============================================================================
+// Pool (main thread only: HIGGS callbacks and the frame callback both run there)
+// ============================================================================
+
+// Kept dense: retiring swaps the last entry into the hole so the batch loop never skips slots
+struct ThrownObjectPool {
+    std::size_t count = 0;
+    std::array<RE::ObjectRefHandle, kMaxThrownObjects> handle{};
+    std::array<RE::NiPoint3, kMaxThrownObjects> lastPos{};
+    std::array<float, kMaxThrownObjects> massScale{};
+    std::array<float, kMaxThrownObjects> age{};
+    std::array<float, kMaxThrownObjects> restTime{};
+    std::array<bool, kMaxThrownObjects> hasLast{};
+    std::array<bool, kMaxThrownObjects> inWater{};
+};
+
+ThrownObjectPool s_pool;
+std::chrono::steady_clock::time_point s_lastFrame{};
+bool s_haveLastFrame = false;
+
+std::atomic<std::uint32_t> s_statTracked{ 0 };
+std::atomic<std::uint64_t> s_statSplashes{ 0 };
+std::atomic<std::uint64_t> s_statDropped{ 0 };
+
+// Heavier objects make bigger splashes, with diminishing returns: 1 -> 1.0, 10 -> ~1.9, 50+ -> 2.5
+float MassScaleForWeight(float weight) {
+    const float w = std::max(0.1f, weight);
+    return std::clamp(0.6f + 0.4f * std::log2(1.0f + w), 0.5f, 2.5f);
+}
+
+float WeightOf(RE::TESObjectREFR* ref) {
+    auto base = ref ? ref->GetBaseObject() : nullptr;
+    auto weightForm = base ? base->As<RE::TESWeightForm>() : nullptr;
+    if (weightForm && weightForm->weight > 0.0f) return weightForm->weight;
+    return kDefaultObjectWeight;
+}
+
+std::size_t FindTracked(const RE::ObjectRefHandle& h) {
+    for (std::size_t i = 0; i < s_pool.count; ++i) {
+        if (s_pool.handle[i] == h) return i;
+    }
+    return kMaxThrownObjects;
+}
+
+void Retire(std::size_t i) {
+    const std::size_t last = --s_pool.count;
+    if (i != last) {
+        s_pool.handle[i] = s_pool.handle[last];
+        s_pool.lastPos[i] = s_pool.lastPos[last];
+        s_pool.massScale[i] = s_pool.massScale[last];
+        s_pool.age[i] = s_pool.age[last];
+        s_pool.restTime[i] = s_pool.restTime[last];
+        s_pool.hasLast[i] = s_pool.hasLast[last];
+        s_pool.inWater[i] = s_pool.inWater[last];
+    }
+    s_pool.handle[last] = RE::ObjectRefHandle{};
+}
+
+// ============================================================================
+// HIGGS callbacks
+// ============================================================================
+
+void OnDropped(bool /*isLeft*/, RE::TESObjectREFR* droppedRefr) {
+    if (!cfgThrownObjectsEnabled || !droppedRefr) return;
+
+    const RE::ObjectRefHandle h = droppedRefr->GetHandle();
+    if (FindTracked(h) != kMaxThrownObjects) return;
+    if (s_pool.count >= kMaxThrownObjects) {
+        s_statDropped.fetch_add(1);
+        return;
+    }
+
+    const std::size_t i = s_pool.count++;
+    s_pool.handle[i] = h;
+    s_pool.lastPos[i] = RE::NiPoint3{};
+    s_pool.massScale[i] = MassScaleForWeight(WeightOf(droppedRefr));
+    s_pool.age[i] = 0.0f;
+    s_pool.restTime[i] = 0.0f;
+    s_pool.hasLast[i] = false;
+    s_pool.inWater[i] = false;
+}
+
+// Grabbing an object again hands it back to the hand probes
+void OnGrabbed(bool /*isLeft*/, RE::TESObjectREFR* grabbedRefr) {
+    if (!grabbedRefr) return;
+    const std::size_t i = FindTracked(grabbedRefr->GetHandle());
+    if (i != kMaxThrownObjects) Retire(i);
+}
+
+// One batch over the whole pool per frame
+void OnFrame() {
+    const auto now = std::chrono::steady_clock::now();
+    const float dt = s_haveLastFrame ? std::chrono::duration<float>(now - s_lastFrame).count() : 0.0f;
+    s_lastFrame = now;
+    s_haveLastFrame = true;
+
+    if (s_pool.count == 0) {
+        s_statTracked.store(0);
+        return;
+    }
+    if (g_suspendAllDetections.load() || g_gameLoadInProgress.load() || dt <= 1e-4f) return;
+
+    std::size_t i = 0;
+    while (i < s_pool.count) {
+        auto refPtr = s_pool.handle[i].get();
+        RE::TESObjectREFR* ref = refPtr.get();
+        RE::NiAVObject* node = ref && !ref->IsDisabled() && ref->GetParentCell() ? ref->Get3D() : nullptr;
+        s_pool.age[i] += dt;
+        if (!node || s_pool.age[i] > kThrownTimeoutSeconds) {
+            Retire(i);
+            continue;
+        }
+
+        const RE::NiPoint3 pos = node->world.translate;
+        WaterQuery q;
+        QueryWater(pos, q);
+
+        if (s_pool.hasLast[i]) {
+            const RE::NiPoint3 d = pos - s_pool.lastPos[i];
+            const float speed = d.Length() / dt;
+            const float vz = d.z / dt;
+
+            if (q.inWater && !s_pool.inWater[i] && q.hasWater) {
+                const float downSpeed = std::max(0.0f, -vz);
+                if (downSpeed >= cfgEntryDownZThreshold) {
+                    const float scale = s_pool.massScale[i] * cfgThrownSplashScale;
+                    const float amt = ComputeEntrySplashAmount(std::min(downSpeed, kMaxEntryDownSpeed)) * scale;
+                    if (amt > 0.0f) {
+                        EmitRipple(RE::NiPoint3{ pos.x, pos.y, q.surfaceZ }, amt, RippleSource::Entry);
+                        PlayEntrySplashAtNode(node, downSpeed, std::min(1.0f, scale) * cfgThrownSplashVolume);
+                        s_statSplashes.fetch_add(1);
+                    }
+                }
+            }
+
+            s_pool.restTime[i] = speed < kRestSpeed ? s_pool.restTime[i] + dt : 0.0f;
+            if (s_pool.restTime[i] >= kRestSeconds) {
+                Retire(i);
+                continue;
+            }
+        }
+
+        s_pool.lastPos[i] = pos;
+        s_pool.inWater[i] = q.inWater;
+        s_pool.hasLast[i] = true;
+        ++i;
+    }
+
+    s_statTracked.store(static_cast<std::uint32_t>(s_pool.count));
+}
+
+}  // namespace
+
+// ============================================================================
+// Public API
+// ============================================================================
+
+void RegisterThrownObjectCallbacks() {
+    auto higgs = HiggsPluginAPI::g_higgsInterface;
+    if (!higgs) return;
+    higgs->AddDroppedCallback(OnDropped);
+    higgs->AddGrabbedCallback(OnGrabbed);
+    higgs->AddPostVrikPostHiggsCallback(OnFrame);
+    IW_LOG_INFO("RegisterThrownObjectCallbacks: tracking objects released from HIGGS hands");
+}
+
+void ResetThrownObjects() {
+    for (std::size_t i = 0; i < s_pool.count; ++i) {
+        s_pool.handle[i] = RE::ObjectRefHandle{};
+    }
+    s_pool.count = 0;
+    s_haveLastFrame = false;
+    s_statTracked.store(0);
+}
+
+ThrownObjectStats GetThrownObjectStats() {
+    ThrownObjectStats st;
+    st.tracked = s_statTracked.load();
+    st.splashes = s_statSplashes.load();
+    st.dropped = s_statDropped.load();
+    return st;
+}
+
+} // namespace InteractiveWaterVR
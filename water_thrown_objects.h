@@ -0,0 +1,31 @@
+#pragma once
+// water_thrown_objects.h - Splashes for objects the player drops or throws (HIGGS)
+
+#include <RE/Skyrim.h>
+#include <cstdint>
+
+namespace InteractiveWaterVR {
+
+// ============================================================================
+// Thrown object tracking
+// ============================================================================
+
+// Objects released from a HIGGS hand are tracked in a fixed pool until they come to rest, unload
+// or time out. The pool is processed in one batch per frame from the HIGGS post-update callback;
+// crossing the water surface fires a splash scaled by the object's weight and vertical speed.
+
+struct ThrownObjectStats {
+    std::uint32_t tracked = 0;     // objects currently in the pool
+    std::uint64_t splashes = 0;    // lifetime water entries
+    std::uint64_t dropped = 0;     // releases ignored because the pool was full
+};
+
+// Register the HIGGS dropped/grabbed/per-frame callbacks (call once after the interface is obtained)
+void RegisterThrownObjectCallbacks();
+
+// Forget every tracked object (game load / state reset)
+void ResetThrownObjects();
+
+ThrownObjectStats GetThrownObjectStats();
+
+} // namespace InteractiveWaterVR
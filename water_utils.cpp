@@ -2,6 +2,7 @@
 
 #include "water_utils.h"
 #include "water_state.h"
+#include "water_splash_curve.h"
 #include "config.h"
 #include "helper.h"
 #include <cmath>
@@ -63,17 +64,12 @@ RE::NiPoint3 GetControllerForward(bool rightHand) {
 // Water detection
 // ============================================================================
 
-bool IsPointInWater(const RE::NiPoint3& a_pos, float& outWaterHeight) {
-    outWaterHeight = 0.0f;
-    
-    // rate-limit noisy logs
-    static auto s_lastIsPointLog = std::chrono::steady_clock::now() - std::chrono::seconds(10);
-    constexpr auto kLogInterval = std::chrono::seconds(2);
-    auto nowLog = std::chrono::steady_clock::now();
+bool QueryWater(const RE::NiPoint3& a_pos, WaterQuery& out) {
+    out = WaterQuery{};
 
     auto tes = RE::TES::GetSingleton();
     if (!tes) {
-return false;
+        return false;
     }
   
     auto cell = tes->GetCell(a_pos);
@@ -83,16 +79,42 @@ return false;
     
     float wh = 0.0f;
     if (cell->GetWaterHeight(a_pos, wh)) {
-        outWaterHeight = wh;
-        if (!std::isfinite(outWaterHeight)) {
+        if (!std::isfinite(wh)) {
             return false;
         }
+        out.hasWater = true;
+        out.surfaceZ = wh;
         constexpr float kThreshold = 0.02f;
-        bool inWater = (outWaterHeight - a_pos.z) > kThreshold;
-  return inWater;
+        out.inWater = (wh - a_pos.z) > kThreshold;
     }
     
-    return false;
+    return out.inWater;
+}
+
+bool IsPointInWater(const RE::NiPoint3& a_pos, float& outWaterHeight) {
+    WaterQuery q;
+    bool inWater = QueryWater(a_pos, q);
+    outWaterHeight = q.surfaceZ;
+    return inWater;
+}
+
+// ============================================================================
+// Hover (above-surface) state
+// ============================================================================
+
+HoverState ComputeHoverState(const RE::NiPoint3& a_pos, const WaterQuery& a_water, float a_velZ) {
+    HoverState h;
+    if (!a_water.hasWater) {
+        return h;
+    }
+    h.height = a_pos.z - a_water.surfaceZ;
+    h.hovering = h.height >= -kHoverDetectionBelowTolerance && h.height <= kHoverDetectionMaxHeight;
+    h.approachSpeed = -a_velZ;
+    constexpr float kMinApproachSpeed = 1.0f;
+    if (h.height > 0.0f && h.approachSpeed > kMinApproachSpeed) {
+        h.timeToContact = h.height / h.approachSpeed;
+    }
+    return h;
 }
 
 void LogWaterDetailsAtPosition(const RE::NiPoint3& a_pos) {
@@ -108,44 +130,14 @@ float ComputeEntrySplashAmount(float downSpeed) {
     if (downSpeed <= 0.1f) {
         return 0.0f;
     }
-
-    float amt = 0.0f;
-    if (downSpeed <= cfgSplashVeryLightMax) {
-        amt = cfgSplashVeryLightAmt;
-    } else if (downSpeed <= cfgSplashLightMax) {
-     amt = cfgSplashLightAmt;
-  } else if (downSpeed <= cfgSplashNormalMax) {
-   amt = cfgSplashNormalAmt;
-    } else if (downSpeed <= cfgSplashHardMax) {
- amt = cfgSplashHardAmt;
-    } else {
-        amt = cfgSplashVeryHardAmt;
-    }
-
-    amt *= cfgSplashScale;
-    return amt;
+    return EvaluateEntrySplash(downSpeed).amt * cfgSplashScale;
 }
 
 float ComputeExitSplashAmount(float upSpeed) {
     if (upSpeed <= 0.1f) {
         return 0.0f;
     }
-    
-    float amt = 0.0f;
-    if (upSpeed <= cfgSplashExitVeryLightMax) {
-        amt = cfgSplashExitVeryLightAmt;
-    } else if (upSpeed <= cfgSplashExitLightMax) {
-  amt = cfgSplashExitLightAmt;
-    } else if (upSpeed <= cfgSplashExitNormalMax) {
-        amt = cfgSplashExitNormalAmt;
-    } else if (upSpeed <= cfgSplashExitHardMax) {
-        amt = cfgSplashExitHardAmt;
-    } else {
-        amt = cfgSplashExitVeryHardAmt;
-    }
-    
-    amt *= cfgSplashScale;
-    return amt;
+    return EvaluateExitSplash(upSpeed).amt * cfgSplashScale;
 }
 
 // ============================================================================
@@ -24,9 +24,33 @@ RE::NiPoint3 GetControllerForward(bool rightHand);
 // Water detection
 // ============================================================================
 
+// Result of one water query at a point: whether the cell has a water plane there, its height,
+// and whether the point is below it
+struct WaterQuery {
+    bool hasWater = false;
+    bool inWater = false;
+    float surfaceZ = 0.0f;
+};
+
+// Single GetCell + GetWaterHeight lookup. Returns out.inWater.
+bool QueryWater(const RE::NiPoint3& a_pos, WaterQuery& out);
 bool IsPointInWater(const RE::NiPoint3& a_pos, float& outWaterHeight);
 void LogWaterDetailsAtPosition(const RE::NiPoint3& a_pos);
 
+// ============================================================================
+// Hover (above-surface) state
+// ============================================================================
+
+struct HoverState {
+    bool hovering = false;
+    float height = 0.0f;          // height above the surface (negative = below)
+    float approachSpeed = 0.0f;   // closing speed toward the surface (units/s, positive = descending)
+    float timeToContact = -1.0f;  // seconds until the surface is reached at the current speed, -1 if not approaching
+};
+
+// Derive hover state analytically from an existing water query and the probe's filtered vertical velocity
+HoverState ComputeHoverState(const RE::NiPoint3& a_pos, const WaterQuery& a_water, float a_velZ);
+
 // ============================================================================
 // Splash amount computation
 // ============================================================================
@@ -0,0 +1,120 @@
+// water_wake_trail.cpp - Wake ripples laid along the hand's path at fixed arc-length spacing
+
+#include "water_wake_trail.h"
+#include "detection_core.h"
+#include "water_ripple.h"
+#include "water_state.h"
+#include <algorithm>
+#include <cmath>
+
+namespace InteractiveWaterVR {
+
+// ============================================================================
+// Depth fade
+// ============================================================================
+
+namespace {
+
+// A hand just under the surface throws the strongest wake; deeper, it fades to kWakeFadeMinScale
+inline float DepthFade(float depth) {
+    const float t = std::clamp((depth - kWakeFadeStartDepth) / (kWakeFadeEndDepth - kWakeFadeStartDepth), 0.0f, 1.0f);
+    return 1.0f - t * (1.0f - kWakeFadeMinScale);
+}
+
+}  // namespace
+
+// ============================================================================
+// WakeTrail
+// ============================================================================
+
+void WakeTrail::Reset() {
+    _count = 0;
+}
+
+void WakeTrail::AddSample(const RE::NiPoint3& surfacePos, float speed, float depth) {
+    // Full: fold the newest point into the last slot so both ends of the path are kept
+    const std::size_t i = _count < kMaxPathPoints ? _count++ : kMaxPathPoints - 1;
+    _x[i] = surfacePos.x;
+    _y[i] = surfacePos.y;
+    _z[i] = surfacePos.z;
+    _speed[i] = speed;
+    _depth[i] = depth;
+}
+
+int WakeTrail::Emit(const WakeTrailParams& params) {
+    if (_count < 2 || params.spacing <= 0.0f || params.maxPerEmit <= 0) return 0;
+
+    // Segment lengths along the surface (horizontal; the wake lies on the water plane)
+    std::array<float, kMaxPathPoints> segLen{};
+    float pathLen = 0.0f;
+    for (std::size_t s = 0; s + 1 < _count; ++s) {
+        const float dx = _x[s + 1] - _x[s];
+        const float dy = _y[s + 1] - _y[s];
+        segLen[s] = std::sqrt(dx * dx + dy * dy);
+        pathLen += segLen[s];
+    }
+
+    // Bounded work: a long path (fast sweep, slow poll) gets wider spacing, not more ripples
+    float spacing = params.spacing;
+    const int n = WakeRippleCount(pathLen, params.spacing, std::min(params.maxPerEmit, static_cast<int>(kMaxRipples)), spacing);
+    if (n <= 0) return 0;
+
+    // Pass 1 (scalar, monotone): segment and fraction for each ripple's arc position
+    std::array<std::size_t, kMaxRipples> seg{};
+    std::array<float, kMaxRipples> frac{};
+    std::size_t s = 0;
+    float segStart = 0.0f;  // arc position of the current segment's start
+    for (int k = 0; k < n; ++k) {
+        const float arc = spacing * static_cast<float>(k + 1);
+        while (s + 2 < _count && arc > segStart + segLen[s]) {
+            segStart += segLen[s];
+            ++s;
+        }
+        seg[k] = s;
+        frac[k] = segLen[s] > 0.0f ? std::clamp((arc - segStart) / segLen[s], 0.0f, 1.0f) : 1.0f;
+    }
+
+    // Pass 2 (straight-line arithmetic over SoA lanes): position, speed, depth fade and amplitude
+    std::array<float, kMaxRipples> px{}, py{}, pz{}, amt{};
+    for (int k = 0; k < n; ++k) {
+        const std::size_t a = seg[k];
+        const std::size_t b = a + 1;
+        const float t = frac[k];
+        px[k] = _x[a] + t * (_x[b] - _x[a]);
+        py[k] = _y[a] + t * (_y[b] - _y[a]);
+        pz[k] = _z[a] + t * (_z[b] - _z[a]);
+        const float speed = _speed[a] + t * (_speed[b] - _speed[a]);
+        const float depth = _depth[a] + t * (_depth[b] - _depth[a]);
+        const float mult = std::clamp(speed * params.speedScale, params.minMult, params.maxMult);
+        amt[k] = params.baseAmt * mult * DepthFade(depth);
+    }
+
+    for (int k = 0; k < n; ++k) {
+        QueueRipple(RippleSource::Wake, RE::NiPoint3{ px[k], py[k], pz[k] }, amt[k]);
+    }
+
+    // Restart the path at the last ripple; whatever lies beyond it carries into the next emission
+    const std::size_t last = seg[n - 1];
+    const float t = frac[n - 1];
+    const float lastX = px[n - 1], lastY = py[n - 1], lastZ = pz[n - 1];
+    const float lastSpeed = _speed[last] + t * (_speed[last + 1] - _speed[last]);
+    const float lastDepth = _depth[last] + t * (_depth[last + 1] - _depth[last]);
+    std::size_t w = 0;
+    _x[w] = lastX;
+    _y[w] = lastY;
+    _z[w] = lastZ;
+    _speed[w] = lastSpeed;
+    _depth[w] = lastDepth;
+    ++w;
+    for (std::size_t r = last + 1; r < _count; ++r, ++w) {
+        _x[w] = _x[r];
+        _y[w] = _y[r];
+        _z[w] = _z[r];
+        _speed[w] = _speed[r];
+        _depth[w] = _depth[r];
+    }
+    _count = w;
+    return n;
+}
+
+} // namespace InteractiveWaterVR
@@ -0,0 +1,56 @@
+#pragma once
+// water_wake_trail.h - Wake ripples laid along the hand's path at fixed arc-length spacing
+
+#include <RE/Skyrim.h>
+#include <array>
+#include <cstddef>
+
+namespace InteractiveWaterVR {
+
+// ============================================================================
+// Trail parameters
+// ============================================================================
+
+struct WakeTrailParams {
+    float spacing = 10.0f;          // arc length between wake ripples (units)
+    int maxPerEmit = 6;             // ripples per emission; spacing widens to cover longer paths
+    float baseAmt = 0.0f;           // cfgWakeAmt
+    float speedScale = 1.0f;        // amplitude multiplier per unit of speed
+    float minMult = 1.0f;
+    float maxMult = 1.0f;
+};
+
+// ============================================================================
+// Single trail
+// ============================================================================
+
+// Collects the filtered hand path between emissions (one point per tick) and, when an emission is
+// due, resamples it at fixed arc length. Amplitude follows the speed interpolated along the path
+// and fades with hand depth, so fast sweeps and slow poll rates both leave a continuous wake.
+class WakeTrail {
+public:
+    static constexpr std::size_t kMaxPathPoints = 8;
+    static constexpr std::size_t kMaxRipples = 16;
+
+    void Reset();
+
+    // Append this tick's filtered position (z replaced by the surface), speed and depth
+    void AddSample(const RE::NiPoint3& surfacePos, float speed, float depth);
+
+    // Queue wake ripples along the collected path; returns how many were queued. The path restarts
+    // at the last ripple, so the next emission continues the spacing without a gap.
+    int Emit(const WakeTrailParams& params);
+
+    bool HasPath() const { return _count > 0; }
+
+private:
+    // Path since the last ripple (structure of arrays; point 0 is the last ripple or trail start)
+    std::array<float, kMaxPathPoints> _x{};
+    std::array<float, kMaxPathPoints> _y{};
+    std::array<float, kMaxPathPoints> _z{};
+    std::array<float, kMaxPathPoints> _speed{};
+    std::array<float, kMaxPathPoints> _depth{};
+    std::size_t _count = 0;
+};
+
+} // namespace InteractiveWaterVR
@@ -0,0 +1,493 @@
+// worker_runtime.cpp - Fixed pool of worker threads running the plugin's periodic and one-shot jobs
+
+#include "worker_runtime.h"
+#include "periodic_schedule.h"
+#include "helper.h"
+#include "config.h"
+#include <algorithm>
+#include <array>
+#include <condition_variable>
+#include <cstdio>
+#include <cwchar>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+#include <windows.h>
+#include <timeapi.h>
+
+namespace InteractiveWaterVR {
+
+// ============================================================================
+// Job types
+// ============================================================================
+
+const char* JobTypeName(JobType type) {
+    switch (type) {
+        case JobType::WaterMonitor: return "WaterMonitor";
+        case JobType::SpellMonitor: return "SpellMonitor";
+        case JobType::FrostChargeSpawner: return "FrostChargeSpawner";
+        case JobType::ScaleTween: return "ScaleTween";
+        case JobType::Despawn: return "Despawn";
+        case JobType::FrostChargeRemoval: return "FrostChargeRemoval";
+        case JobType::SoundFlagTimer: return "SoundFlagTimer";
+        case JobType::RecordDump: return "RecordDump";
+        case JobType::StartRetry: return "StartRetry";
+        default: return "Unknown";
+    }
+}
+
+bool JobEndsWithSession(JobType type) {
+    switch (type) {
+        case JobType::ScaleTween:
+        case JobType::Despawn:
+        case JobType::FrostChargeRemoval:
+        case JobType::SoundFlagTimer:
+            return true;
+        default:
+            return false;
+    }
+}
+
+void JobSlot::Destroy() {
+    if (_destroy) _destroy(_storage);
+    _invoke = nullptr;
+    _destroy = nullptr;
+}
+
+// ============================================================================
+// Job table and deadline queue
+// ============================================================================
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+// A run that starts this long after its deadline counts as late in the stats
+constexpr long long kLateThresholdUs = 2000;
+
+struct JobState {
+    JobSlot slot;
+    JobType type = JobType::Count;
+    std::uint32_t generation = 0;
+    bool live = false;
+    bool queued = false;     // has an entry in the deadline queue
+    bool running = false;
+    bool cancelled = false;  // retire after the run in progress
+    bool paused = false;
+    bool fixedRate = false;
+    std::thread::id runner;
+    // Fixed-rate jobs only
+    PeriodicDeadline<Clock> deadline;
+    Clock::time_point lastStart{};  // epoch = no previous run to measure a period against
+    JobDelay lastNominal{};         // start-to-start gap the next run is due after (skipped slots included)
+};
+
+struct QueueEntry {
+    Clock::time_point due;
+    std::uint32_t index = 0;
+    std::uint32_t generation = 0;
+};
+
+// Min-heap on the deadline
+struct LaterDeadline {
+    bool operator()(const QueueEntry& a, const QueueEntry& b) const { return a.due > b.due; }
+};
+
+struct JobTypeStats {
+    std::uint32_t live = 0;
+    std::uint32_t runs = 0;
+    std::uint32_t lateRuns = 0;
+    std::uint64_t wallUs = 0;
+    std::uint64_t cycles = 0;
+    std::uint32_t maxWallUs = 0;
+    std::uint32_t maxLateUs = 0;
+    PeriodJitter jitter;
+};
+
+std::mutex s_mutex;
+std::condition_variable s_workCv;  // workers: new job, earlier deadline, resume
+std::condition_variable s_doneCv;  // cancellers: a run ended
+std::array<JobState, kMaxJobs> s_jobs;
+std::vector<QueueEntry> s_queue;
+std::vector<std::uint32_t> s_free;
+std::array<JobTypeStats, kJobTypeCount> s_stats{};
+bool s_paused = false;
+bool s_spinning = false;  // one worker at a time spins toward a fixed-rate deadline
+int s_workerCount = 0;
+std::uint32_t s_peakLive = 0;
+std::uint64_t s_tableFull = 0;
+std::once_flag s_startOnce;
+
+void PushLocked(std::uint32_t index, Clock::time_point due) {
+    JobState& job = s_jobs[index];
+    job.queued = true;
+    s_queue.push_back(QueueEntry{ due, index, job.generation });
+    std::push_heap(s_queue.begin(), s_queue.end(), LaterDeadline{});
+}
+
+void PopLocked() {
+    std::pop_heap(s_queue.begin(), s_queue.end(), LaterDeadline{});
+    s_queue.pop_back();
+}
+
+// Destroys the capture; any queue entry left behind is skipped by its stale generation
+void RetireLocked(std::uint32_t index) {
+    JobState& job = s_jobs[index];
+    job.slot.Destroy();
+    --s_stats[static_cast<std::size_t>(job.type)].live;
+    job.live = false;
+    job.queued = false;
+    job.running = false;
+    job.cancelled = false;
+    job.paused = false;
+    job.fixedRate = false;
+    job.lastStart = Clock::time_point{};
+    ++job.generation;
+    s_free.push_back(index);
+}
+
+JobState* FindLocked(const JobHandle& handle) {
+    if (!handle.Valid()) return nullptr;
+    JobState& job = s_jobs[handle.index];
+    if (!job.live || job.generation != handle.generation) return nullptr;
+    return &job;
+}
+
+std::uint64_t ThreadCycles() {
+    ULONG64 cycles = 0;
+    ::QueryThreadCycleTime(::GetCurrentThread(), &cycles);
+    return static_cast<std::uint64_t>(cycles);
+}
+
+void ApplyWorkerSettings(int workerIndex) {
+    wchar_t name[64];
+    std::swprintf(name, 64, L"InteractiveWaterVR worker %d", workerIndex);
+    ::SetThreadDescription(::GetCurrentThread(), name);
+    // -2..2 map onto THREAD_PRIORITY_LOWEST..THREAD_PRIORITY_HIGHEST
+    if (cfgWorkerPriority != 0 && !::SetThreadPriority(::GetCurrentThread(), cfgWorkerPriority)) {
+        IW_LOG_WARN("WorkerRuntime: SetThreadPriority(%d) failed (error %lu)", cfgWorkerPriority, ::GetLastError());
+    }
+    if (cfgWorkerAffinityMask != 0 &&
+        !::SetThreadAffinityMask(::GetCurrentThread(), static_cast<DWORD_PTR>(cfgWorkerAffinityMask))) {
+        IW_LOG_WARN("WorkerRuntime: SetThreadAffinityMask(0x%llX) failed (error %lu)",
+            static_cast<unsigned long long>(cfgWorkerAffinityMask), ::GetLastError());
+    }
+}
+
+void WorkerLoop(int workerIndex) {
+    ApplyWorkerSettings(workerIndex);
+
+    std::unique_lock<std::mutex> lock(s_mutex);
+    for (;;) {
+        if (s_paused || s_queue.empty()) {
+            s_workCv.wait(lock);
+            continue;
+        }
+        const QueueEntry top = s_queue.front();
+        JobState& job = s_jobs[top.index];
+        if (!job.live || job.generation != top.generation) {
+            PopLocked();
+            continue;
+        }
+        if (job.paused) {
+            // Parked: ResumeJob queues it again
+            PopLocked();
+            job.queued = false;
+            continue;
+        }
+        const auto start = Clock::now();
+        if (top.due > start) {
+            const auto spin = std::chrono::microseconds(cfgTickSpinUs);
+            if (job.fixedRate && spin > JobDelay::zero() && !s_spinning) {
+                s_spinning = true;
+                // The lock is dropped for each spin iteration so scheduling calls are not held up
+                WaitUntilPrecise<Clock>(top.due, spin,
+                    [&](Clock::time_point until) { return s_workCv.wait_until(lock, until) == std::cv_status::timeout; },
+                    [&]() {
+                        lock.unlock();
+                        YieldProcessor();
+                        lock.lock();
+                    });
+                s_spinning = false;
+            } else {
+                s_workCv.wait_until(lock, top.due);
+            }
+            // Re-check the queue head: the job may have been cancelled or displaced meanwhile
+            continue;
+        }
+
+        PopLocked();
+        job.queued = false;
+        job.running = true;
+        job.runner = std::this_thread::get_id();
+        lock.unlock();
+
+        const std::uint64_t cyclesBefore = ThreadCycles();
+        JobDelay next = kJobDone;
+        try {
+            next = job.slot.Invoke();
+        } catch (...) {
+            IW_LOG_WARN("WorkerRuntime: %s job threw; retiring it", JobTypeName(job.type));
+        }
+        const std::uint64_t cycles = ThreadCycles() - cyclesBefore;
+        const auto end = Clock::now();
+
+        lock.lock();
+        job.running = false;
+        job.runner = std::thread::id{};
+
+        auto& st = s_stats[static_cast<std::size_t>(job.type)];
+        const auto wallUs = static_cast<std::uint32_t>(std::chrono::duration_cast<std::chrono::microseconds>(end - start).count());
+        const auto lateUs = static_cast<std::uint32_t>(std::chrono::duration_cast<std::chrono::microseconds>(start - top.due).count());
+        ++st.runs;
+        st.wallUs += wallUs;
+        st.cycles += cycles;
+        st.maxWallUs = std::max(st.maxWallUs, wallUs);
+        st.maxLateUs = std::max(st.maxLateUs, lateUs);
+        if (lateUs > kLateThresholdUs) ++st.lateRuns;
+
+        if (job.fixedRate) {
+            if (job.lastStart != Clock::time_point{}) {
+                st.jitter.Add(std::chrono::duration_cast<std::chrono::microseconds>(start - job.lastStart).count(),
+                    job.lastNominal.count());
+            }
+            job.lastStart = start;
+            job.lastNominal = next;
+        }
+
+        if (job.cancelled || next < JobDelay::zero()) {
+            RetireLocked(top.index);
+        } else if (!job.paused) {
+            if (job.fixedRate) {
+                const std::uint32_t skipped = job.deadline.Advance(end, next);
+                st.jitter.AddSkipped(skipped);
+                // The next start lands 1 + skipped periods after this one; measured against a
+                // single period it would read as jitter
+                job.lastNominal = next * (1 + skipped);
+                PushLocked(top.index, job.deadline.Due());
+            } else {
+                PushLocked(top.index, end + next);
+            }
+            // Another worker may be sleeping toward a later deadline
+            s_workCv.notify_one();
+        }
+        s_doneCv.notify_all();
+    }
+}
+
+void StartWorkersOnce() {
+    const int count = std::clamp(cfgWorkerThreads, 1, 4);
+    {
+        std::lock_guard<std::mutex> lock(s_mutex);
+        s_queue.reserve(kMaxJobs * 2);
+        s_free.reserve(kMaxJobs);
+        for (std::uint32_t i = kMaxJobs; i-- > 0;) s_free.push_back(i);
+        s_workerCount = count;
+    }
+    // Sleeps toward fixed-rate deadlines need ~1 ms timer granularity, not the default 15.6 ms
+    if (cfgTickSpinUs > 0) ::timeBeginPeriod(1);
+    // Workers live as long as the process; detached so static destruction never sees a joinable thread
+    for (int i = 0; i < count; ++i) {
+        std::thread(WorkerLoop, i).detach();
+    }
+    IW_LOG_INFO("WorkerRuntime: started %d worker(s), priority %d, affinity 0x%llX, %u job slots",
+        count, cfgWorkerPriority, static_cast<unsigned long long>(cfgWorkerAffinityMask), kMaxJobs);
+}
+
+}  // namespace
+
+// ============================================================================
+// Scheduling
+// ============================================================================
+
+namespace detail {
+
+JobSlot* AcquireJobSlot(JobHandle& handle) {
+    StartWorkerRuntime();
+    std::lock_guard<std::mutex> lock(s_mutex);
+    if (s_free.empty()) {
+        if (s_tableFull++ == 0) IW_LOG_WARN("WorkerRuntime: all %u job slots in use; dropping new jobs", kMaxJobs);
+        return nullptr;
+    }
+    const std::uint32_t index = s_free.back();
+    s_free.pop_back();
+    // Reserved but not live yet: nothing can find or run it before SubmitJobSlot
+    handle.index = index;
+    handle.generation = s_jobs[index].generation;
+    return &s_jobs[index].slot;
+}
+
+void SubmitJobSlot(JobType type, const JobHandle& handle, JobDelay delay, bool fixedRate) {
+    {
+        std::lock_guard<std::mutex> lock(s_mutex);
+        JobState& job = s_jobs[handle.index];
+        job.type = type;
+        job.live = true;
+        job.fixedRate = fixedRate;
+        auto& st = s_stats[static_cast<std::size_t>(type)];
+        ++st.live;
+        s_peakLive = std::max(s_peakLive, static_cast<std::uint32_t>(kMaxJobs - s_free.size()));
+        const auto due = Clock::now() + std::max(delay, JobDelay::zero());
+        job.deadline.Start(due);
+        PushLocked(handle.index, due);
+    }
+    s_workCv.notify_one();
+}
+
+}  // namespace detail
+
+long long CancelJob(JobHandle& handle) {
+    const JobHandle target = handle;
+    handle = JobHandle{};
+
+    std::unique_lock<std::mutex> lock(s_mutex);
+    JobState* job = FindLocked(target);
+    if (!job) return 0;
+    if (!job->running) {
+        RetireLocked(target.index);
+        return 0;
+    }
+    job->cancelled = true;
+    if (job->runner == std::this_thread::get_id()) return 0;
+
+    // A run is in progress on another worker: jobs never sleep, so this is at most one run
+    const auto start = Clock::now();
+    s_doneCv.wait(lock, [&] { return FindLocked(target) == nullptr; });
+    return std::chrono::duration_cast<std::chrono::microseconds>(Clock::now() - start).count();
+}
+
+bool IsJobScheduled(const JobHandle& handle) {
+    std::lock_guard<std::mutex> lock(s_mutex);
+    const JobState* job = FindLocked(handle);
+    return job && !job->cancelled;
+}
+
+void PauseJob(const JobHandle& handle) {
+    std::lock_guard<std::mutex> lock(s_mutex);
+    if (JobState* job = FindLocked(handle)) job->paused = true;
+}
+
+void ResumeJob(const JobHandle& handle) {
+    {
+        std::lock_guard<std::mutex> lock(s_mutex);
+        JobState* job = FindLocked(handle);
+        if (!job || !job->paused) return;
+        job->paused = false;
+        // The pause is not a period
+        job->lastStart = Clock::time_point{};
+        if (!job->queued && !job->running) {
+            // A fixed-rate job starts a new grid
+            const auto now = Clock::now();
+            job->deadline.Start(now);
+            PushLocked(handle.index, now);
+        }
+    }
+    s_workCv.notify_one();
+}
+
+void PauseJobs() {
+    std::lock_guard<std::mutex> lock(s_mutex);
+    s_paused = true;
+}
+
+void ResumeJobs() {
+    {
+        std::lock_guard<std::mutex> lock(s_mutex);
+        s_paused = false;
+        for (auto& job : s_jobs) job.lastStart = Clock::time_point{};
+    }
+    s_workCv.notify_all();
+}
+
+bool JobsPaused() {
+    std::lock_guard<std::mutex> lock(s_mutex);
+    return s_paused;
+}
+
+int CancelSessionJobs(const char* reason) {
+    const auto start = Clock::now();
+    std::unique_lock<std::mutex> lock(s_mutex);
+    int cancelled = 0;
+    std::vector<JobHandle> running;
+    for (std::uint32_t i = 0; i < kMaxJobs; ++i) {
+        JobState& job = s_jobs[i];
+        if (!job.live || !JobEndsWithSession(job.type) || job.cancelled) continue;
+        ++cancelled;
+        if (job.running) {
+            job.cancelled = true;
+            running.push_back(JobHandle{ i, job.generation });
+        } else {
+            RetireLocked(i);
+        }
+    }
+    // Session jobs only post to the main thread and never cancel each other, so their runs are short
+    s_doneCv.wait(lock, [&] {
+        return std::none_of(running.begin(), running.end(), [](const JobHandle& h) { return FindLocked(h) != nullptr; });
+    });
+    lock.unlock();
+    if (cancelled > 0) {
+        const double ms = std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+        IW_LOG_INFO("CancelSessionJobs (%s): cancelled %d job(s) in %.2f ms", reason, cancelled, ms);
+    }
+    return cancelled;
+}
+
+// ============================================================================
+// Workers
+// ============================================================================
+
+void StartWorkerRuntime() {
+    std::call_once(s_startOnce, StartWorkersOnce);
+}
+
+// ============================================================================
+// Reporting
+// ============================================================================
+
+void LogJobStats() {
+    std::array<JobTypeStats, kJobTypeCount> snap;
+    std::uint32_t inUse = 0;
+    std::uint32_t peak = 0;
+    std::uint64_t tableFull = 0;
+    int workers = 0;
+    {
+        std::lock_guard<std::mutex> lock(s_mutex);
+        snap = s_stats;
+        for (auto& st : s_stats) {
+            const std::uint32_t live = st.live;
+            st = JobTypeStats{};
+            st.live = live;
+        }
+        inUse = kMaxJobs - static_cast<std::uint32_t>(s_free.size());
+        peak = s_peakLive;
+        tableFull = s_tableFull;
+        workers = s_workerCount;
+    }
+
+    std::vector<std::string> lines;
+    char buf[256];
+    for (std::size_t t = 0; t < kJobTypeCount; ++t) {
+        const auto& st = snap[t];
+        if (st.runs == 0) continue;
+        std::snprintf(buf, sizeof(buf), "  %-18s live=%u runs=%u wall avg/max=%.0f/%u us cpu avg=%.1f kcycles late max=%u us (>2 ms: %u)",
+            JobTypeName(static_cast<JobType>(t)), st.live, st.runs,
+            static_cast<double>(st.wallUs) / st.runs, st.maxWallUs,
+            static_cast<double>(st.cycles) / st.runs / 1000.0, st.maxLateUs, st.lateRuns);
+        lines.emplace_back(buf);
+        auto jitter = snap[t].jitter.Take();
+        if (jitter.count > 0) {
+            std::snprintf(buf, sizeof(buf), "  %-18s period avg %.3f ms (nominal %.3f) jitter p50/p95/max=%u/%u/%u us skipped=%u",
+                "", jitter.meanPeriodUs / 1000.0, jitter.meanNominalUs / 1000.0,
+                jitter.p50DevUs, jitter.p95DevUs, jitter.maxDevUs, jitter.skipped);
+            lines.emplace_back(buf);
+        }
+    }
+    if (lines.empty()) return;
+    std::snprintf(buf, sizeof(buf), "Worker jobs: %d worker(s), %u/%u slots in use, peak %u, dropped (table full) %llu",
+        workers, inUse, kMaxJobs, peak, static_cast<unsigned long long>(tableFull));
+    lines.insert(lines.begin(), buf);
+    AppendLinesToPluginLog("INFO", lines);
+}
+
+} // namespace InteractiveWaterVR
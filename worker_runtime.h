@@ -0,0 +1,163 @@
+#pragma once
+// worker_runtime.h - Fixed pool of worker threads running the plugin's periodic and one-shot jobs
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+namespace InteractiveWaterVR {
+
+// ============================================================================
+// Job types
+// ============================================================================
+
+enum class JobType : std::uint8_t {
+    WaterMonitor = 0,
+    SpellMonitor,
+    FrostChargeSpawner,
+    ScaleTween,
+    Despawn,
+    FrostChargeRemoval,
+    SoundFlagTimer,
+    RecordDump,
+    StartRetry,
+    Count
+};
+
+constexpr std::size_t kJobTypeCount = static_cast<std::size_t>(JobType::Count);
+
+const char* JobTypeName(JobType type);
+
+// Tweens, despawns and timers belong to the game session that scheduled them and are cancelled
+// by CancelSessionJobs; monitors and spawners are stopped by their owners
+bool JobEndsWithSession(JobType type);
+
+// ============================================================================
+// Jobs
+// ============================================================================
+
+// A job's callable runs on a worker and returns the delay until its next run, or kJobDone. A
+// one-shot job returns kJobDone on its first run; a periodic job returns its period; a multi-step
+// job (a scale tween) keeps its step counter in its capture and returns kJobDone after the last.
+// Delays are measured from the end of the run (ScheduleJob) or from the deadline just served
+// (SchedulePeriodicJob).
+using JobDelay = std::chrono::microseconds;
+constexpr JobDelay kJobDone{ -1 };
+
+// Capture storage per job; the largest job (the spell monitor with its edge state) captures ~48 bytes
+constexpr std::size_t kJobStorageBytes = 96;
+constexpr std::uint32_t kMaxJobs = 128;
+
+struct JobHandle {
+    std::uint32_t index = kMaxJobs;
+    std::uint32_t generation = 0;
+
+    bool Valid() const { return index < kMaxJobs; }
+};
+
+// The callable of one job, stored inline in the runtime's job table
+class JobSlot {
+public:
+    template <class F>
+    void Emplace(F&& fn) {
+        using Fn = std::decay_t<F>;
+        ::new (static_cast<void*>(_storage)) Fn(std::forward<F>(fn));
+        _invoke = [](void* p) -> JobDelay { return (*static_cast<Fn*>(p))(); };
+        _destroy = [](void* p) { static_cast<Fn*>(p)->~Fn(); };
+    }
+
+    JobDelay Invoke() { return _invoke(_storage); }
+    void Destroy();
+
+private:
+    alignas(std::max_align_t) unsigned char _storage[kJobStorageBytes];
+    JobDelay (*_invoke)(void*) = nullptr;
+    void (*_destroy)(void*) = nullptr;
+};
+
+namespace detail {
+// Returns nullptr (and logs) when the job table is full
+JobSlot* AcquireJobSlot(JobHandle& handle);
+void SubmitJobSlot(JobType type, const JobHandle& handle, JobDelay delay, bool fixedRate);
+}
+
+// ============================================================================
+// Scheduling
+// ============================================================================
+
+// Run fn on a worker after `delay`, then again after every delay it returns until it returns
+// kJobDone or is cancelled. The callable is stored inline (no std::function, no heap). Returns an
+// invalid handle, without running fn, if all kMaxJobs slots are taken.
+namespace detail {
+template <class F>
+JobHandle EmplaceJob(JobType type, JobDelay delay, bool fixedRate, F&& fn) {
+    using Fn = std::decay_t<F>;
+    static_assert(sizeof(Fn) <= kJobStorageBytes, "job capture does not fit in a job slot");
+    static_assert(alignof(Fn) <= alignof(std::max_align_t), "job capture is over-aligned");
+    static_assert(std::is_convertible_v<std::invoke_result_t<Fn&>, JobDelay>, "a job returns its next delay");
+    JobHandle handle;
+    JobSlot* slot = AcquireJobSlot(handle);
+    if (!slot) return JobHandle{};
+    slot->Emplace(std::forward<F>(fn));
+    SubmitJobSlot(type, handle, delay, fixedRate);
+    return handle;
+}
+}
+
+template <class F>
+JobHandle ScheduleJob(JobType type, JobDelay delay, F&& fn) {
+    return detail::EmplaceJob(type, delay, false, std::forward<F>(fn));
+}
+
+// Fixed-rate variant for ticks whose per-interval quantities (speeds, rates) should see a steady
+// period: deadlines sit on an absolute grid (each returned delay counts from the deadline just
+// served, so work time and oversleep never accumulate), the last [Performance] TickSpinUs before
+// each deadline is spun rather than slept, overrun slots are skipped rather than replayed, and the
+// start-to-start period jitter is reported by LogJobStats.
+template <class F>
+JobHandle SchedulePeriodicJob(JobType type, JobDelay firstDelay, F&& fn) {
+    return detail::EmplaceJob(type, firstDelay, true, std::forward<F>(fn));
+}
+
+// The job never runs again. If a run is in progress on another worker, waits for it to end and
+// returns how long that took (us); a job may cancel itself, which takes effect after its run.
+// Resets the handle. No-op (returns 0) for a finished or invalid handle.
+long long CancelJob(JobHandle& handle);
+
+// True until the job has returned kJobDone or been cancelled
+bool IsJobScheduled(const JobHandle& handle);
+
+// A paused job keeps its slot and capture but does not run; Resume runs it again straight away
+void PauseJob(const JobHandle& handle);
+void ResumeJob(const JobHandle& handle);
+
+// Whole runtime: workers finish the run in progress and then idle until ResumeJobs. Overdue
+// periodic jobs run once on resume; missed periods are not replayed.
+void PauseJobs();
+void ResumeJobs();
+bool JobsPaused();
+
+// Cancel every job of a session type (tweens, despawns, timers); returns how many were cancelled
+int CancelSessionJobs(const char* reason);
+
+// ============================================================================
+// Workers
+// ============================================================================
+
+// Start the worker threads ([Performance] WorkerThreads / WorkerPriority / WorkerAffinityMask).
+// Idempotent; the first ScheduleJob starts the runtime if nothing did before. The settings are read
+// once: changing them needs a restart of the game.
+void StartWorkerRuntime();
+
+// ============================================================================
+// Reporting
+// ============================================================================
+
+// Per-type runs, wall and CPU time per run, deadline lateness, and (fixed-rate jobs) period jitter
+// since the previous call; logs only types that ran
+void LogJobStats();
+
+} // namespace InteractiveWaterVR
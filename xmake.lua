@@ -28,6 +28,8 @@ target("commonlibsse-ng-template")
 
     -- add dependencies to target
     add_deps("commonlibsse-ng")
+    -- timeBeginPeriod for the worker runtime's tick timing
+    add_syslinks("winmm")
 
     -- add commonlibsse-ng plugin rule metadata (keeps manifest info)
     add_rules("commonlibsse-ng.plugin", {
@@ -56,6 +58,8 @@ target("skse_plugin")
     -- depend on commonlibsse-ng so its includes are provided
     add_deps("commonlibsse-ng")
     add_includedirs("lib/commonlibsse-ng/include")
+    -- timeBeginPeriod for the worker runtime's tick timing
+    add_syslinks("winmm")
 
     -- Point to local SKSE VR SDK (user-provided path)
     local skse_sdk = "C:/Users/user/Desktop/Gaming apps/skyrim vr mod tools folder/MODS/SKSE MOD DEV/sksevr_2_00_12/sksevr_2_00_12/src"
@@ -85,3 +89,46 @@ target("skse_plugin")
     if is_mode("release") then
         set_symbols("debug")
     end
+
+-- Standalone telemetry reader (no CommonLib dependency; builds on Windows and Linux)
+target("telemetry_reader")
+    set_kind("binary")
+    set_languages("c++23")
+    add_files("tools/telemetry_reader.cpp")
+    add_includedirs("src")
+
+-- Standalone event trace decoder (no CommonLib dependency; builds on Windows and Linux)
+target("trace_decoder")
+    set_kind("binary")
+    set_languages("c++23")
+    add_files("tools/trace_decoder.cpp")
+    add_includedirs("src")
+
+-- Standalone config tuner: replays labelled hand traces through the detection core on all cores
+-- (no CommonLib dependency; builds on Windows and Linux)
+target("config_tuner")
+    set_kind("binary")
+    set_languages("c++23")
+    add_files("tools/config_tuner.cpp", "src/detection_core.cpp", "src/motion_filter.cpp")
+    add_includedirs("src")
+    if is_plat("linux") then
+        add_syslinks("pthread")
+    end
+
+-- Standalone allocation test for main-thread task posting: builds main_thread_tasks.cpp against the
+-- stub SKSE/RE headers in tools/stubs and fails if steady-state posting touches the heap
+target("task_slab_alloc_test")
+    set_kind("binary")
+    set_languages("c++23")
+    add_files("tools/task_slab_alloc_test.cpp", "src/main_thread_tasks.cpp")
+    add_includedirs("tools/stubs", "src")
+    if is_plat("linux") then
+        add_syslinks("pthread")
+    end
+
+-- Standalone fake-clock test for the worker runtime's periodic scheduling (periodic_schedule.h)
+target("periodic_schedule_test")
+    set_kind("binary")
+    set_languages("c++23")
+    add_files("tools/periodic_schedule_test.cpp")
+    add_includedirs("src")